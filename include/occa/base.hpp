@@ -38,6 +38,9 @@
 #include <occa/device.hpp>
 #include <occa/kernel.hpp>
 #include <occa/memory.hpp>
+#include <occa/graph.hpp>
+#include <occa/tuner.hpp>
+#include <occa/future.hpp>
 
 namespace occa {
   //---[ Device Functions ]-------------
@@ -77,6 +80,10 @@ namespace occa {
   kernel buildKernelFromBinary(const std::string &filename,
                                const std::string &kernelName,
                                const occa::properties &props = occa::properties());
+
+  kernelFuture buildKernelAsync(const std::string &filename,
+                                const std::string &kernelName,
+                                const occa::properties &props = occa::properties());
   //====================================
 
   //---[ Memory Functions ]-------------
@@ -30,12 +30,15 @@
 #include <occa/uva.hpp>
 #include <occa/kernel.hpp>
 #include <occa/tools/gc.hpp>
+#include <occa/tools/sys.hpp>
 
 namespace occa {
   class modeKernel_t; class kernel;
   class modeMemory_t; class memory;
   class modeDevice_t; class device;
   class deviceInfo;
+  class graph_t; class graph;
+  class kernelFuture;
 
   typedef void* stream_t;
   class stream;
@@ -45,6 +48,11 @@ namespace occa {
   typedef cachedKernelMap::iterator       cachedKernelMapIterator;
   typedef cachedKernelMap::const_iterator cCachedKernelMapIterator;
 
+  // Pooled blocks are keyed by their size class and allocation properties
+  typedef std::pair<udim_t, hash_t>         pooledMemoryKey;
+  typedef std::map<pooledMemoryKey, memoryVector> pooledMemoryMap;
+  typedef pooledMemoryMap::iterator         pooledMemoryMapIterator;
+
   //---[ modeDevice_t ]---------------------
   class modeDevice_t {
   public:
@@ -54,17 +62,35 @@ namespace occa {
     gc::ring_t<device> deviceRing;
     gc::ring_t<modeKernel_t> kernelRing;
     gc::ring_t<modeMemory_t> memoryRing;
+    gc::ring_t<graph_t> graphRing;
 
     ptrRangeMap uvaMap;
-    memoryVector uvaStaleMemory;
+
+    // Intrusive list of managed memory written to by kernels
+    modeMemory_t *staleMemory;
+    udim_t bytesSyncedToDevice;
+    udim_t bytesSyncedToHost;
 
     stream_t currentStream;
     std::vector<stream_t> streams;
 
     udim_t bytesAllocated;
+    udim_t maxBytesAllocated;
+
+    // Freed pooled blocks, keyed by their size class and properties
+    pooledMemoryMap pooledMemory;
+    udim_t bytesPooled;
 
     cachedKernelMap cachedKernels;
 
+    // Guards kernelRing and build state used by buildKernelAsync threads
+    mutex kernelMutex;
+    // buildKernelAsync jobs that haven't finished
+    int buildJobs;
+
+    // Records launches and copies instead of running them
+    graph_t *capturingGraph;
+
     modeDevice_t(const occa::properties &properties_);
 
     void dontUseRefs();
@@ -78,6 +104,9 @@ namespace occa {
     void addMemoryRef(modeMemory_t *mem);
     void removeMemoryRef(modeMemory_t *mem);
 
+    void addGraphRef(graph_t *graph_);
+    void removeGraphRef(graph_t *graph_);
+
     //---[ Virtual Methods ]------------
     virtual ~modeDevice_t() = 0;
     // Must be able to be called multiple times safely
@@ -105,7 +134,8 @@ namespace occa {
     void writeKernelBuildFile(const std::string &filename,
                               const hash_t &kernelHash,
                               const occa::properties &kernelProps,
-                              const lang::kernelMetadataMap &metadataMap) const;
+                              const lang::kernelMetadataMap &metadataMap,
+                              const strVector &dependencies = strVector()) const;
 
     std::string getKernelHash(const std::string &fullHash,
                               const std::string &kernelName);
@@ -131,6 +161,18 @@ namespace occa {
     //  |===============================
 
     //  |---[ Memory ]------------------
+    void addBytesAllocated(const udim_t bytes);
+
+    static udim_t poolBlockSize(const udim_t bytes);
+    modeMemory_t* getPooledMemory(const udim_t blockBytes,
+                                  const occa::properties &props);
+    void addPooledMemory(modeMemory_t *mem);
+    void trimMemoryPool();
+
+    void addStaleMemory(modeMemory_t *mem);
+    void removeStaleMemory(modeMemory_t *mem);
+    void syncStaleMemory();
+
     virtual modeMemory_t* malloc(const udim_t bytes,
                                  const void* src,
                                  const occa::properties &props) = 0;
@@ -193,6 +235,13 @@ namespace occa {
 
     udim_t memorySize() const;
     udim_t memoryAllocated() const;
+    udim_t maxMemoryAllocated() const;
+    udim_t memoryPooled() const;
+
+    void trimMemoryPool();
+
+    udim_t bytesSyncedToDevice() const;
+    udim_t bytesSyncedToHost() const;
 
     void finish();
 
@@ -211,6 +260,12 @@ namespace occa {
                        const streamTag &endTag);
     //  |===============================
 
+    //  |---[ Graph ]-------------------
+    void beginCapture(const occa::properties &props = occa::properties());
+    occa::graph endCapture();
+    bool isCapturing() const;
+    //  |===============================
+
     //  |---[ Kernel ]------------------
     occa::kernel buildKernel(const std::string &filename,
                              const std::string &kernelName,
@@ -224,6 +279,18 @@ namespace occa {
                                        const std::string &kernelName,
                                        const occa::properties &props = occa::properties()) const;
 
+    // Compiles the kernel in a background thread, it's loaded
+    //   when the future's kernel is requested
+    occa::kernelFuture buildKernelAsync(const std::string &filename,
+                                        const std::string &kernelName,
+                                        const occa::properties &props = occa::properties()) const;
+
+    // Builds the kernel into the cache without loading it
+    //   Safe to call from other threads
+    void prebuildKernel(const std::string &filename,
+                        const std::string &kernelName,
+                        const occa::properties &props = occa::properties()) const;
+
     void loadKernels(const std::string &library = "");
     //  |===============================
 
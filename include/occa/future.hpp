@@ -0,0 +1,150 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_FUTURE_HEADER
+#define OCCA_FUTURE_HEADER
+
+#include <deque>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/device.hpp>
+#include <occa/kernel.hpp>
+#include <occa/tools/exception.hpp>
+#include <occa/tools/properties.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  class kernelBuildPool_t;
+
+  //---[ kernelBuildJob_t ]-------------
+  // A kernel build queued with device::buildKernelAsync
+  //   A pool worker compiles the kernel into the cache while the
+  //   job's kernelFuture handles and kernel stay on the calling thread
+  //   The caller's settings() are copied when the job is queued and
+  //   used by the worker during the build
+  class kernelBuildJob_t {
+  public:
+    occa::device device;
+    std::string filename;
+    std::string kernelName;
+    occa::properties props;
+    occa::properties settings;
+
+    // Guards done
+    condition doneCondition;
+    bool done;
+    exception *error;
+
+    // Loaded from the cache by kernelFuture::get
+    occa::kernel builtKernel;
+
+    // Only changed by kernelFuture handles
+    int refs;
+
+    kernelBuildJob_t(const occa::device &device_,
+                     const std::string &filename_,
+                     const std::string &kernelName_,
+                     const occa::properties &props_);
+    ~kernelBuildJob_t();
+
+    void run();
+    void cancel();
+    void releaseDevice();
+    void finish();
+    bool isDone();
+    void wait();
+  };
+  //====================================
+
+  //---[ kernelBuildPool_t ]------------
+  // Bounded set of threads shared by all devices
+  //   Uses [OCCA_BUILD_THREADS] threads, defaulting to the core count
+  class kernelBuildPool_t {
+  public:
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    std::vector<pthread_t> threads;
+#else
+    std::vector<HANDLE> threads;
+#endif
+
+    // Guards jobs, runningJobs and stopping
+    condition jobCondition;
+    std::deque<kernelBuildJob_t*> jobs;
+    std::vector<kernelBuildJob_t*> runningJobs;
+    bool stopping;
+
+    kernelBuildPool_t();
+    ~kernelBuildPool_t();
+
+    static kernelBuildPool_t& get();
+    static int defaultSize();
+
+    int size() const;
+
+    void start(const int threadCount);
+    void stop();
+
+    void push(kernelBuildJob_t *job);
+    kernelBuildJob_t* pop();
+    void finishJob(kernelBuildJob_t *job);
+
+    // Cancels queued jobs for [modeDevice] and waits for its running ones
+    void removeDeviceJobs(modeDevice_t *modeDevice);
+  };
+
+  void* kernelBuildLoop(void *args);
+  //====================================
+
+  //---[ kernelFuture ]-----------------
+  // Handle to a kernel being built in the background
+  //   Dropping the last handle waits for the build to finish
+  //
+  // Note: Handles should stay on the thread that created them
+  class kernelFuture {
+  private:
+    kernelBuildJob_t *job;
+
+  public:
+    kernelFuture();
+    kernelFuture(kernelBuildJob_t *job_);
+    kernelFuture(const kernelFuture &other);
+    kernelFuture& operator = (const kernelFuture &other);
+    ~kernelFuture();
+
+  private:
+    void setJob(kernelBuildJob_t *job_);
+    void removeRef();
+
+  public:
+    bool isInitialized() const;
+
+    bool isReady() const;
+    void wait() const;
+
+    // Waits for the build, rethrowing its error if it failed
+    occa::kernel get() const;
+  };
+  //====================================
+}
+
+#endif
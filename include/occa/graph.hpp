@@ -0,0 +1,203 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_GRAPH_HEADER
+#define OCCA_GRAPH_HEADER
+
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/kernel.hpp>
+#include <occa/memory.hpp>
+#include <occa/tools/gc.hpp>
+#include <occa/tools/properties.hpp>
+
+namespace occa {
+  class modeDevice_t;
+  class graph_t;
+  class graph;
+
+  typedef void* stream_t;
+
+  //---[ Graph Nodes ]------------------
+  // Byte range a node reads or writes, used to find dependencies
+  class graphAccess_t {
+  public:
+    const char *start, *end;
+    bool isWrite;
+
+    graphAccess_t(const void *ptr,
+                  const udim_t bytes,
+                  const bool isWrite_);
+
+    bool conflictsWith(const graphAccess_t &other) const;
+  };
+
+  class graphNode_t {
+  public:
+    std::vector<graphAccess_t> accesses;
+    // Nodes in the same level don't depend on each other
+    int level;
+
+    graphNode_t();
+    virtual ~graphNode_t();
+
+    void addAccess(const void *ptr,
+                   const udim_t bytes,
+                   const bool isWrite);
+
+    bool dependsOn(const graphNode_t &other) const;
+
+    virtual bool isBarrier() const;
+
+    // [async] is set when sibling nodes run on other streams
+    virtual void run(const bool async) = 0;
+  };
+
+  class graphLaunchNode_t : public graphNode_t {
+  public:
+    occa::kernel launchedKernel;
+    std::vector<kernelArg> arguments;
+    std::vector<bool> argIsConst;
+
+    graphLaunchNode_t(const occa::kernel &kernel_);
+
+    virtual void run(const bool async);
+  };
+
+  class graphCopyNode_t : public graphNode_t {
+  public:
+    // Either memory can be replaced by a host pointer
+    occa::memory dest, src;
+    void *destPtr;
+    const void *srcPtr;
+    udim_t bytes;
+    udim_t destOffset, srcOffset;
+    occa::properties props, asyncProps;
+
+    graphCopyNode_t(occa::memory dest_,
+                    void *destPtr_,
+                    const udim_t destOffset_,
+                    occa::memory src_,
+                    const void *srcPtr_,
+                    const udim_t srcOffset_,
+                    const udim_t bytes_,
+                    const occa::properties &props_);
+
+    virtual void run(const bool async);
+  };
+
+  // Recorded stream tags order all nodes before and after them
+  class graphBarrierNode_t : public graphNode_t {
+  public:
+    virtual bool isBarrier() const;
+
+    virtual void run(const bool async);
+  };
+  //====================================
+
+  //---[ graph_t ]----------------------
+  class graph_t : public gc::ringEntry_t {
+  public:
+    modeDevice_t *modeDevice;
+    occa::properties properties;
+
+    gc::ring_t<graph> graphRing;
+
+    std::vector<graphNode_t*> nodes;
+    std::vector<std::vector<graphNode_t*> > levels;
+
+    // Independent nodes are spread across these streams
+    std::vector<stream_t> streams;
+
+    graph_t(modeDevice_t *modeDevice_,
+            const occa::properties &properties_);
+    ~graph_t();
+
+    void dontUseRefs();
+    void addGraphRef(graph *graph_);
+    void removeGraphRef(graph *graph_);
+    bool needsFree() const;
+
+    void free();
+
+    void addLaunch(const occa::kernel &kernel);
+
+    void addCopy(occa::memory dest,
+                 void *destPtr,
+                 const udim_t destOffset,
+                 occa::memory src,
+                 const void *srcPtr,
+                 const udim_t srcOffset,
+                 const udim_t bytes,
+                 const occa::properties &props);
+
+    void addBarrier();
+
+    void addNode(graphNode_t *node);
+
+    void setupLevels();
+    void setupStreams();
+
+    void run();
+  };
+  //====================================
+
+  //---[ graph ]------------------------
+  // Kernel launches and copies recorded between
+  //   device::beginCapture() and device::endCapture()
+  class graph : public gc::ringEntry_t {
+    friend class occa::graph_t;
+
+  private:
+    graph_t *modeGraph;
+
+  public:
+    graph();
+    graph(graph_t *modeGraph_);
+
+    graph(const graph &g);
+    graph& operator = (const graph &g);
+    ~graph();
+
+  private:
+    void setModeGraph(graph_t *modeGraph_);
+    void removeGraphRef();
+
+  public:
+    void dontUseRefs();
+
+    bool isInitialized() const;
+
+    graph_t* getModeGraph() const;
+
+    int size() const;
+    int levels() const;
+
+    void run();
+
+    void free();
+  };
+  //====================================
+}
+
+#endif
@@ -55,6 +55,15 @@ namespace occa {
     void writeBuildFile(const std::string &filename,
                         const hash_t &hash,
                         const occa::properties &props);
+
+    void setDependencyProps(occa::json &props,
+                            const strVector &filenames);
+
+    bool dependenciesChanged(const std::string &buildFile);
+
+    void removeStaleBuild(const std::string &filename,
+                          const std::string &hashDir,
+                          const hash_t &hash);
   }
 }
 
@@ -29,14 +29,23 @@ namespace occa {
   class hash_t;
 
   namespace io {
+    // Lock file guarded by flock(), released locks remove the file
+    //   so waiting processes get notified and skip the locked work
     class lock_t {
     private:
-      mutable std::string lockDir;
+      mutable std::string lockFile;
+      mutable int fd;
       mutable bool isMineCached;
       float staleWarning;
       float staleAge;
       mutable bool released;
 
+      // Copies would release the lock file held by the original
+      lock_t(const lock_t &other);
+      lock_t& operator = (const lock_t &other);
+
+      bool tryLock();
+
     public:
       lock_t();
 
@@ -48,7 +57,7 @@ namespace occa {
 
       bool isInitialized() const;
 
-      const std::string& dir() const;
+      const std::string& file() const;
 
       void release() const;
 
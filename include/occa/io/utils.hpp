@@ -37,6 +37,8 @@ namespace occa {
     extern const std::string hostSourceFile;
     extern const std::string hostBinaryFile;
     extern const std::string hostBuildFile;
+    extern const std::string tuneFile;
+    extern const std::string buildLogFile;
   }
 
   namespace io {
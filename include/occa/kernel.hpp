@@ -39,6 +39,7 @@ namespace occa {
   class modeMemory_t; class memory;
   class modeDevice_t; class device;
   class kernelBuilder;
+  class kernelFrame;
 
   namespace lang {
     class parser_t;
@@ -121,6 +122,9 @@ namespace occa {
     void setModeKernel(modeKernel_t *modeKernel_);
     void removeKernelRef();
 
+    void setArguments(const kernelArg **args,
+                      const int argc) const;
+
   public:
     void dontUseRefs();
 
@@ -140,6 +144,10 @@ namespace occa {
     const std::string& sourceFilename();
     const std::string& binaryFilename();
 
+    occa::kernel specialize(const std::string &argName,
+                            const primitive &value);
+    occa::kernel specialize(const occa::properties &values);
+
     int maxDims();
     dim maxOuterDims();
     dim maxInnerDims();
@@ -156,6 +164,42 @@ namespace occa {
   };
   //====================================
 
+  //---[ kernelFrame ]------------------
+  // Arguments bound to a kernel once and reused across launches.
+  //   Running a frame lends its arguments to the kernel instead of
+  //   copying them, so only arguments changed with setArg are copied
+  //   Arguments passed by value are copied into the frame since the
+  //   caller's objects may not outlive it
+  class kernelFrame {
+  private:
+    occa::kernel launchedKernel;
+    std::vector<kernelArg> arguments;
+    std::vector<char> values;
+
+    void copyValues();
+
+  public:
+    kernelFrame();
+    kernelFrame(const occa::kernel &kernel_);
+    kernelFrame(const kernelFrame &other);
+    kernelFrame& operator = (const kernelFrame &other);
+
+    bool isInitialized();
+
+    occa::kernel getKernel();
+    int argumentCount() const;
+    const std::vector<kernelArg>& getArguments() const;
+
+    void setArguments(const kernelArg **args,
+                      const int argc);
+    kernelFrame& setKernel(const occa::kernel &kernel_);
+    kernelFrame& setArg(const int argPos,
+                        const kernelArg &arg);
+
+    void run();
+  };
+  //====================================
+
   //---[ kernelBuilder ]----------------
   class kernelBuilder {
   protected:
@@ -201,6 +245,39 @@ namespace occa {
   };
   //====================================
 
+  //---[ kernelBatch ]------------------
+  // Queues kernel launches and runs them as one fused kernel
+  //   (see okl/fuse) when they come from the same source and
+  //   their arguments allow it
+  class kernelBatch {
+  private:
+    std::vector<kernelFrame> frames;
+    // Fused kernel name and the members' hash
+    std::string fusedKey;
+    kernelBuilder fusedBuilder;
+
+  public:
+    kernelBatch();
+
+    int size() const;
+    void clear();
+
+    kernelBatch& add(const kernelFrame &frame);
+
+    bool canFuse();
+    occa::kernel getFusedKernel();
+    bool getFusedArguments(occa::kernel fusedKernel,
+                           std::vector<const kernelArg*> &args);
+
+    void run();
+
+    static int getArgumentIndex(const lang::kernelMetadata &metadata,
+                                const std::string &name);
+    static bool argumentsMatch(const kernelArg &a,
+                               const kernelArg &b);
+  };
+  //====================================
+
 
   //---[ Kernel Properties ]------------
   std::string assembleHeader(const occa::properties &props);
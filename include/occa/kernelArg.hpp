@@ -33,15 +33,16 @@ namespace occa {
   class modeDevice_t; class device;
   class kernelArgData;
 
-  typedef std::vector<kernelArgData>          kArgVector;
-  typedef kArgVector::iterator                kArgVectorIterator;
-  typedef kArgVector::const_iterator          cKArgVectorIterator;
+  typedef kernelArgData*                      kArgVectorIterator;
+  typedef const kernelArgData*                cKArgVectorIterator;
 
   //---[ KernelArg ]--------------------
   namespace kArgInfo {
     static const char none       = 0;
     static const char usePointer = (1 << 0);
     static const char hasTexture = (1 << 1);
+    // Points to an argument passed by value (e.g. type2<TM>)
+    static const char isValue    = (1 << 2);
   }
 
   union kernelArgData_t {
@@ -78,6 +79,34 @@ namespace occa {
     void* ptr() const;
   };
 
+  // Nearly every kernelArg holds one entry, keep it inline to avoid
+  //   a heap allocation per argument on each launch
+  class kArgVector {
+  private:
+    kernelArgData inlineArg;
+    kernelArgData *heapArgs;
+    int size_;
+    int capacity;
+
+  public:
+    kArgVector();
+    kArgVector(const kArgVector &other);
+    kArgVector& operator = (const kArgVector &other);
+    ~kArgVector();
+
+    int size() const;
+    void clear();
+    void push_back(const kernelArgData &arg);
+
+    kernelArgData& operator [] (const int index);
+    const kernelArgData& operator [] (const int index) const;
+
+    kArgVectorIterator begin();
+    kArgVectorIterator end();
+    cKArgVectorIterator begin() const;
+    cKArgVectorIterator end() const;
+  };
+
   class kernelArg {
   public:
     kArgVector args;
@@ -103,12 +132,12 @@ namespace occa {
 
     template <class TM>
     kernelArg(const type2<TM> &arg) {
-      add((void*) const_cast<type2<TM>*>(&arg), sizeof(type2<TM>), false);
+      addValue((void*) const_cast<type2<TM>*>(&arg), sizeof(type2<TM>));
     }
 
     template <class TM>
     kernelArg(const type4<TM> &arg) {
-      add((void*) const_cast<type4<TM>*>(&arg), sizeof(type4<TM>), false);
+      addValue((void*) const_cast<type4<TM>*>(&arg), sizeof(type4<TM>));
     }
 
     template <class TM>
@@ -133,6 +162,8 @@ namespace occa {
     void add(void *arg, size_t bytes,
              bool lookAtUva = true, bool argIsUva = false);
 
+    void addValue(void *arg, size_t bytes);
+
     void setupForKernelCall(const bool isConst) const;
 
     static int argumentCount(const std::vector<kernelArg> &arguments);
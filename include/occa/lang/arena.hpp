@@ -0,0 +1,124 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_LANG_ARENA_HEADER
+#define OCCA_LANG_ARENA_HEADER
+
+#include <cstddef>
+#include <vector>
+
+#include <occa/tools/sys.hpp>
+#include <occa/tools/tls.hpp>
+
+namespace occa {
+  namespace lang {
+    // Recycles the small objects the parser creates and destroys by the
+    //   hundred-thousands (tokens, expression nodes, statements)
+    // Blocks are carved out of large slabs and kept in per-size free lists,
+    //   so allocating and freeing are a couple of pointer swaps
+    // Each thread has its own arena, blocks freed by other threads are
+    //   handed back to the arena owning their slab
+    // Slabs are aligned to their size and start with their owner, and
+    //   are freed once none of the arena's blocks are in use
+    class arena_t {
+    public:
+      static const size_t alignment  = 16;
+      static const size_t maxBytes   = 512;
+      static const size_t slabBytes  = (64 * 1024);
+      static const int    sizeClasses = (int) (maxBytes / alignment);
+
+    private:
+      struct freeBlock_t {
+        freeBlock_t *next;
+      };
+
+      struct remoteBlock_t {
+        remoteBlock_t *next;
+        int sizeClass;
+      };
+
+      freeBlock_t *freeBlocks[sizeClasses];
+      char *slabStart, *slabEnd;
+      std::vector<char*> slabs;
+      // Blocks handed out and not freed back to this arena yet
+      size_t liveBlocks;
+
+      // Blocks freed by other threads
+      mutex remoteMutex;
+      remoteBlock_t *remoteBlocks;
+      int hasRemoteBlocks;
+
+      static char* allocSlab();
+      static void freeSlab(char *slab);
+      static arena_t* slabOwner(void *ptr);
+
+      void freeOwnBlock(void *ptr, const int sizeClass);
+      void freeRemoteBlock(void *ptr, const int sizeClass);
+      void takeRemoteBlocks();
+      void freeSlabs(const bool keepSlab);
+
+    public:
+      arena_t();
+      ~arena_t();
+
+      static arena_t& get();
+
+      void* alloc(const size_t bytes);
+      void free(void *ptr, const size_t bytes);
+
+      // Frees the slabs if no block is in use
+      void release();
+
+      size_t bytesReserved() const;
+    };
+
+    // Slabs can hold blocks other threads still use, so exiting threads
+    //   hand their arena over to the next thread rather than freeing it
+    // Copies acquire their own arena, two handles never share one
+    class arenaHandle_t {
+    public:
+      arena_t *arena;
+
+      arenaHandle_t();
+      arenaHandle_t(const arenaHandle_t &other);
+      ~arenaHandle_t();
+
+      void acquire();
+
+      static mutex& idleMutex();
+      static std::vector<arena_t*>& idleArenas();
+    };
+
+    class arenaObject_t {
+    public:
+      static inline void* operator new(size_t bytes) {
+        return arena_t::get().alloc(bytes);
+      }
+
+      static inline void operator delete(void *ptr, size_t bytes) {
+        arena_t::get().free(ptr, bytes);
+      }
+    };
+  }
+}
+
+#endif
@@ -24,6 +24,7 @@
 
 #include <vector>
 
+#include <occa/lang/arena.hpp>
 #include <occa/lang/printer.hpp>
 #include <occa/lang/scope.hpp>
 #include <occa/lang/attribute.hpp>
@@ -74,7 +75,7 @@ namespace occa {
       extern const int attribute;
     }
 
-    class statement_t {
+    class statement_t : public arenaObject_t {
     public:
       blockStatement *up;
       token_t *source;
@@ -25,6 +25,9 @@
 
 #include <occa/lang/builtins/transforms/dim.hpp>
 #include <occa/lang/builtins/transforms/finders.hpp>
+#include <occa/lang/builtins/transforms/fuse.hpp>
+#include <occa/lang/builtins/transforms/specialize.hpp>
 #include <occa/lang/builtins/transforms/tile.hpp>
+#include <occa/lang/builtins/transforms/tune.hpp>
 
 #endif
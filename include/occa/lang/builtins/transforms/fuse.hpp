@@ -0,0 +1,96 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_LANG_BUILTINS_TRANSFORMS_FUSE_HEADER
+#define OCCA_LANG_BUILTINS_TRANSFORMS_FUSE_HEADER
+
+#include <map>
+#include <vector>
+
+#include <occa/types.hpp>
+#include <occa/lang/statement.hpp>
+
+namespace occa {
+  namespace lang {
+    class exprNode;
+
+    namespace transforms {
+      typedef std::vector<functionDeclStatement*> functionDeclStatementVector;
+      typedef std::map<std::string, variable_t*>  argumentVariableMap;
+
+      // Fuses a sequence of @kernels into a single @kernel
+      //   - Consecutive element-wise @tile loops with matching loop
+      //     headers are merged into one loop
+      //   - Everything else runs back-to-back inside the fused kernel
+      //
+      // Arguments from the first kernel keep their name while arguments
+      //   from the k-th kernel are renamed to _occa_fused<k>_<name>.
+      // Arguments used in merged loop headers are shared with the
+      //   previous kernel and are not added to the fused signature.
+      class kernelFuser {
+      public:
+        blockStatement &root;
+        functionDeclStatementVector kernelSmnts;
+
+        functionDeclStatement *fusedSmnt;
+        forStatement *fusedForSmnt;
+        variable_t *fusedIterator;
+        forStatement *leaderForSmnt;
+        argumentVariableMap previousArgs;
+
+        kernelFuser(blockStatement &root_);
+
+        static std::string fusedKernelName(const strVector &kernelNames);
+        static std::string fusedArgumentName(const int kernelIndex,
+                                             const std::string &name);
+
+        static bool exprMatcher(exprNode &expr);
+
+        bool apply(const strVector &kernelNames);
+
+        bool findKernels(const strVector &kernelNames);
+
+        void setupFusedKernel(const std::string &name);
+
+        void fuseKernel(const int kernelIndex);
+
+        forStatement* getFusableLoop(functionDeclStatement &kernelSmnt);
+
+        bool canMergeLoop(forStatement &forSmnt);
+
+        bool isElementWise(functionDeclStatement &kernelSmnt,
+                           forStatement &forSmnt,
+                           variable_t &iterator);
+
+        void getHeaderVariables(forStatement &forSmnt,
+                                strVector &names);
+
+        static std::string getHeaderSource(forStatement &forSmnt);
+      };
+
+      bool applyFuseTransforms(blockStatement &root,
+                               const strVector &kernelNames);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,86 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_LANG_BUILTINS_TRANSFORMS_SPECIALIZE_HEADER
+#define OCCA_LANG_BUILTINS_TRANSFORMS_SPECIALIZE_HEADER
+
+#include <set>
+
+#include <occa/lang/primitive.hpp>
+#include <occa/lang/builtins/transforms/finders.hpp>
+#include <occa/tools/json.hpp>
+
+namespace occa {
+  namespace lang {
+    class functionDeclStatement;
+
+    namespace transforms {
+      // Replaces uses of a @kernel argument with a constant value
+      //   - Fails if the argument is assigned, incremented or its
+      //     address is taken
+      class specializedArgReplacer_t : public statementExprTransform {
+      private:
+        const variable_t *arg;
+        primitive value;
+        // Expressions are transformed bottom-up, so writes are found
+        //   through the nodes replacing the argument
+        std::set<const exprNode*> valueNodes;
+
+        bool isValueNode(exprNode *node) const;
+        bool modifiesValue(exprNode &node) const;
+
+      public:
+        specializedArgReplacer_t(const variable_t &arg_,
+                                 const primitive &value_);
+
+        virtual statement_t* transformStatement(statement_t &smnt);
+
+        virtual exprNode* transformExprNode(exprNode &node);
+      };
+
+      // Bakes @kernel arguments listed in okl/specialize into the kernel
+      //   - okl/specialize holds { <argument>: <value> } for scalar arguments
+      //   - Specialized arguments are removed from the kernel signature,
+      //     so they are also dropped from the kernel metadata
+      //   - Names matching no @kernel argument are reported as errors
+      class specialize : public statementTransform {
+      public:
+        const json &values;
+        std::set<std::string> specializedNames;
+
+        specialize(const json &values_);
+
+        virtual statement_t* transformStatement(statement_t &smnt);
+
+        bool specializeArgument(functionDeclStatement &kernelSmnt,
+                                const int argIndex);
+
+        bool hasUnusedValues() const;
+      };
+
+      bool applySpecializeTransforms(statement_t &smnt,
+                                     const json &values);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,61 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_LANG_BUILTINS_TRANSFORMS_TUNE_HEADER
+#define OCCA_LANG_BUILTINS_TRANSFORMS_TUNE_HEADER
+
+#include <occa/lang/kernelMetadata.hpp>
+#include <occa/lang/statementTransform.hpp>
+#include <occa/tools/properties.hpp>
+
+namespace occa {
+  namespace lang {
+    class callNode;
+
+    namespace transforms {
+      // Replaces @tile(TUNE(A, B, ...), ...) with one of its options
+      //   - Options are picked through okl/tune/<kernel> which holds
+      //     the option index for each TUNE() in the kernel
+      //   - Defaults to the first option
+      class tune : public statementTransform {
+      public:
+        const occa::properties &settings;
+        kernelTunableMap &tunables;
+
+        tune(const occa::properties &settings_,
+             kernelTunableMap &tunables_);
+
+        virtual statement_t* transformStatement(statement_t &smnt);
+
+        static bool isTuneCall(exprNode &expr);
+
+        static functionDeclStatement* getKernel(statement_t &smnt);
+      };
+
+      bool applyTuneTransforms(statement_t &smnt,
+                               const occa::properties &settings,
+                               kernelTunableMap &tunables);
+    }
+  }
+}
+
+#endif
@@ -25,6 +25,7 @@
 #include <stack>
 #include <vector>
 
+#include <occa/lang/arena.hpp>
 #include <occa/lang/operator.hpp>
 #include <occa/lang/primitive.hpp>
 #include <occa/lang/printer.hpp>
@@ -93,7 +94,7 @@ namespace occa {
       extern const udim_t cudaCall;
     }
 
-    class exprNode {
+    class exprNode : public arenaObject_t {
     public:
       token_t *token;
 
@@ -0,0 +1,88 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_LANG_HEADERCACHE_HEADER
+#define OCCA_LANG_HEADERCACHE_HEADER
+
+#include <map>
+#include <vector>
+
+#include <occa/tools/hash.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace lang {
+    class file_t;
+    class token_t;
+
+    typedef std::vector<token_t*> tokenVector;
+
+    // Tokens of an included file, shared by every parse in the process
+    // The file and tokens are never modified or freed after being cached,
+    //   replays clone the tokens
+    class cachedHeader_t {
+    public:
+      hash_t hash;
+      file_t *file;
+      tokenVector tokens;
+      int errors;
+
+      // Tokens read by #include and #line depend on where the file is
+      //   included, those files go through the tokenizer each time
+      bool replayable;
+
+      // Set when the whole file is wrapped in #ifndef [guardName]
+      std::string guardName;
+      bool pragmaOnce;
+
+      cachedHeader_t(const std::string &filename,
+                     const hash_t &hash_);
+      ~cachedHeader_t();
+
+      bool canReplay() const;
+      void findGuards();
+
+      static bool isDirective(const tokenVector &line,
+                              const std::string &name);
+      static std::string directiveArg(const tokenVector &line);
+    };
+
+    typedef std::map<std::string, cachedHeader_t*> cachedHeaderMap;
+
+    class headerCache_t {
+    private:
+      mutex headerMutex;
+      cachedHeaderMap headers;
+
+    public:
+      headerCache_t();
+
+      static headerCache_t& get();
+
+      // Entries are keyed by the file contents hash and replaced
+      //   (but not freed, their tokens might be in use) on changes
+      cachedHeader_t* getHeader(const std::string &filename);
+    };
+  }
+}
+
+#endif
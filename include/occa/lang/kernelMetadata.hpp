@@ -30,12 +30,15 @@ namespace occa {
     class kernelMetadata;
 
     typedef std::map<std::string, kernelMetadata> kernelMetadataMap;
+    typedef std::map<std::string, std::vector<strVector> > kernelTunableMap;
 
     class argumentInfo {
     public:
       bool isConst;
+      std::string name;
 
-      argumentInfo(const bool isConst_ = false);
+      argumentInfo(const bool isConst_ = false,
+                   const std::string &name_ = "");
 
       static argumentInfo fromJson(const json &j);
       json toJson() const;
@@ -45,6 +48,8 @@ namespace occa {
     public:
       std::string name;
       std::vector<argumentInfo> arguments;
+      // Options for each TUNE() in the kernel
+      std::vector<strVector> tunables;
 
       kernelMetadata();
 
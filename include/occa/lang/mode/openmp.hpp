@@ -33,7 +33,21 @@ namespace occa {
 
         virtual void afterParsing();
 
-        void findOuterMostLoops(statementPtrVector &outerMostSmnts);
+        void setupParallelLoops();
+        std::string getParallelPragma(forStatement &outerSmnt);
+        int getCollapseDepth(forStatement &outerSmnt);
+
+        void setupSimdLoops();
+        void setupSimdLoops(forStatement &outerSmnt);
+        bool canVectorize(forStatement &innerSmnt);
+
+        void addPragma(statement_t &smnt,
+                       const std::string &value);
+
+        static bool usesVariable(exprNode *expr,
+                                 variable_t &var);
+
+        static bool sharedVariableMatcher(exprNode &expr);
       };
     }
   }
@@ -35,6 +35,8 @@ namespace occa {
       class serialParser : public parser_t {
       public:
         static const std::string exclusiveIndexName;
+        static const std::string trampolinePrefix;
+        static const std::string trampolineArgsName;
 
         serialParser(const occa::properties &settings_ = occa::properties());
 
@@ -48,6 +50,8 @@ namespace occa {
 
         static void setupKernel(functionDeclStatement &kernelSmnt);
 
+        void setupKernelTrampoline(functionDeclStatement &kernelSmnt);
+
         void setupExclusives();
 
         void setupExclusiveDeclarations(statementExprMap &exprMap);
@@ -63,6 +67,7 @@ namespace occa {
         void getInnerMostLoops(transforms::smntTreeNode &innerRoot,
                                statementPtrVector &loopSmnts);
 
+        void findOuterMostLoops(statementPtrVector &outerMostSmnts);
 
         static exprNode* updateExclusiveExprNodes(statement_t &smnt,
                                                   exprNode &expr,
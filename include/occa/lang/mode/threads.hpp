@@ -0,0 +1,76 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#ifndef OCCA_LANG_MODES_THREADS_HEADER
+#define OCCA_LANG_MODES_THREADS_HEADER
+
+#include <occa/lang/mode/serial.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace okl {
+      // Kernels get an extra [int *_occa_thread_info] argument
+      //   [0] Outer-most @outer loop to run, or -(loop + 1) to query its size
+      //   [1] First iteration of the chunk
+      //   [2] Last iteration of the chunk (exclusive)
+      //   [3] Iteration count, set by a size query
+      //   [4] Set to 1 by a size query if the loop exists
+      //
+      // The kernel body runs for every size query and chunk, so statements
+      //   outside outer-most loops that write memory only run during the
+      //   size query of the loop following them
+      class threadsParser : public serialParser {
+      public:
+        static const std::string threadInfoName;
+
+        threadsParser(const occa::properties &settings_ = occa::properties());
+
+        virtual void afterParsing();
+
+        void setupThreadInfoArgs();
+
+        void setupOuterStatementGuards();
+
+        void setupOuterStatementGuards(functionDeclStatement &kernelSmnt,
+                                       statementPtrVector &outerSmnts);
+
+        bool writesMemory(statement_t &smnt,
+                          bool &writesOuterVariables);
+
+        static exprNode* getUpdatedValue(exprNode &expr);
+
+        static bool isUpdateOp(exprNode &expr);
+
+        void setupChunkedLoops();
+
+        void setupChunkedLoop(forStatement &forSmnt,
+                              variable_t &infoVar,
+                              const int loopIndex);
+
+        static exprNode* threadInfoEntry(token_t *source,
+                                         variable_t &infoVar,
+                                         const int index);
+      };
+    }
+  }
+}
+
+#endif
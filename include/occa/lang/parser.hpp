@@ -79,6 +79,7 @@ namespace occa {
       blockStatement *up;
       blockStatementList upStack;
       attributeTokenMap attributes;
+      kernelTunableMap tunables;
 
       bool success;
       //================================
@@ -99,6 +100,7 @@ namespace occa {
       void writeToFile(const std::string &filename) const;
 
       void setMetadata(kernelMetadataMap &metadataMap) const;
+      void setDependencies(strVector &dependencies) const;
       //================================
 
       //---[ Setup ]--------------------
@@ -24,6 +24,7 @@
 
 #include <occa/io.hpp>
 
+#include <occa/lang/arena.hpp>
 #include <occa/lang/errorHandler.hpp>
 #include <occa/lang/file.hpp>
 #include <occa/lang/type.hpp>
@@ -91,7 +92,8 @@ namespace occa {
       int mergeEncodings(const int type1, const int type2);
     }
 
-    class token_t : public errorHandler {
+    class token_t : public errorHandler,
+                    public arenaObject_t {
     public:
       fileOrigin origin;
 
@@ -41,6 +41,14 @@ namespace occa {
     typedef std::vector<fileOrigin> originVector;
     typedef trie<const operator_t*> operatorTrie;
 
+    namespace charClass {
+      extern const unsigned char whitespace;
+      extern const unsigned char identifierStart;
+      extern const unsigned char identifier;
+      extern const unsigned char operatorStart;
+      extern const unsigned char primitiveStart;
+    }
+
     int getEncodingType(const std::string &str);
     int getCharacterEncoding(const std::string &str);
     int getStringEncoding(const std::string &str);
@@ -57,6 +65,8 @@ namespace occa {
 
       operatorTrie operators;
       std::string operatorCharcodes;
+      // charClass bits for each char, replacing charset scans
+      unsigned char charClasses[256];
 
       tokenizer_t();
 
@@ -73,6 +83,7 @@ namespace occa {
       virtual ~tokenizer_t();
 
       void setup();
+      void setupCharClasses();
 
       virtual baseStream<token_t*>& clone() const;
 
@@ -94,8 +105,11 @@ namespace occa {
       virtual void setNext(token_t *&out);
 
       void pushSource(const std::string &filename);
+      void pushTokens(const tokenVector &tokens);
       void popSource();
 
+      void rewindOutputCache();
+
       void push();
       void pop(const bool rewind = false);
       void popAndRewind();
@@ -109,9 +123,15 @@ namespace occa {
       void skipTo(const char delimiter);
       void skipTo(const char *delimiters);
       void skipFrom(const char *delimiters);
+      void skipFrom(const unsigned char charClass_);
 
       void skipWhitespace();
 
+      inline bool isCharClass(const char c,
+                              const unsigned char charClass_) const {
+        return (charClasses[(unsigned char) c] & charClass_);
+      }
+
       int peek();
       int shallowPeek();
       int peekForIdentifier();
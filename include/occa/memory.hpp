@@ -59,8 +59,13 @@ namespace occa {
 
     occa::modeDevice_t *modeDevice;
 
+    // Links in the device's stale memory list
+    modeMemory_t *leftStaleEntry;
+    modeMemory_t *rightStaleEntry;
+
     udim_t size;
     bool canBeFreed;
+    bool isPooled;
 
     modeMemory_t(modeDevice_t *modeDevice_,
                  udim_t size_,
@@ -70,6 +75,7 @@ namespace occa {
     void addMemoryRef(memory *mem);
     void removeMemoryRef(memory *mem);
     bool needsFree() const;
+    void removeMemoryRefs();
 
     bool isManaged() const;
     bool inDevice() const;
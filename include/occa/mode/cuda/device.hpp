@@ -75,7 +75,8 @@ namespace occa {
                      const std::string &hostOutputFile,
                      const occa::properties &kernelProps,
                      lang::kernelMetadataMap &hostMetadata,
-                     lang::kernelMetadataMap &deviceMetadata);
+                     lang::kernelMetadataMap &deviceMetadata,
+                     strVector &dependencies);
 
       virtual modeKernel_t* buildKernel(const std::string &filename,
                                         const std::string &kernelName,
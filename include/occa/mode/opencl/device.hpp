@@ -74,7 +74,8 @@ namespace occa {
                      const std::string &hostOutputFile,
                      const occa::properties &kernelProps,
                      lang::kernelMetadataMap &hostMetadata,
-                     lang::kernelMetadataMap &deviceMetadata);
+                     lang::kernelMetadataMap &deviceMetadata,
+                     strVector &dependencies);
 
       virtual modeKernel_t* buildKernel(const std::string &filename,
                                         const std::string &kernelName,
@@ -87,7 +88,7 @@ namespace occa {
                                              lang::kernelMetadataMap &hostMetadata,
                                              lang::kernelMetadataMap &deviceMetadata,
                                              const occa::properties &kernelProps,
-                                             io::lock_t lock);
+                                             io::lock_t &lock);
 
       modeKernel_t* buildLauncherKernel(const std::string &hashDir,
                                         const std::string &kernelName,
@@ -45,7 +45,8 @@ namespace occa {
       virtual bool parseFile(const std::string &filename,
                              const std::string &outputFile,
                              const occa::properties &kernelProps,
-                             lang::kernelMetadataMap &metadata);
+                             lang::kernelMetadataMap &metadata,
+                             strVector &dependencies);
 
       virtual modeKernel_t* buildKernel(const std::string &filename,
                                         const std::string &kernelName,
@@ -25,12 +25,21 @@
 
 #include <occa/defines.hpp>
 #include <occa/device.hpp>
+#include <occa/mode/serial/stream.hpp>
 
 namespace occa {
   namespace serial {
     class device : public occa::modeDevice_t {
       mutable hash_t hash_;
 
+      // Guards tag_t updates from stream workers
+      mutable condition tagCondition;
+      mutable std::vector<tag_t*> tags;
+      mutable int nextTag;
+      mutable double lastTagTime;
+
+      tag_t* getTag(const streamTag &tag) const;
+
     public:
       device(const occa::properties &properties_);
       virtual ~device();
@@ -59,7 +68,8 @@ namespace occa {
       virtual bool parseFile(const std::string &filename,
                              const std::string &outputFile,
                              const occa::properties &kernelProps,
-                             lang::kernelMetadataMap &metadata);
+                             lang::kernelMetadataMap &metadata,
+                             strVector &dependencies);
 
       virtual modeKernel_t* buildKernel(const std::string &filename,
                                         const std::string &kernelName,
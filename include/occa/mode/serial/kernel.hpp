@@ -32,13 +32,23 @@
 namespace occa {
   namespace serial {
     class device;
+    class launchOp_t;
 
     class kernel : public occa::modeKernel_t {
     protected:
       void *dlHandle;
       functionPtr_t function;
+      // Generated entry taking the packed [args], NULL for non-OKL kernels
+      trampolinePtr_t trampoline;
       mutable std::vector<void*> vArgs;
 
+      // Finished launch ops, reused so queued launches don't allocate
+      mutable mutex launchOpMutex;
+      mutable std::vector<launchOp_t*> launchOps;
+
+      int setupArgs() const;
+      launchOp_t* getLaunchOp() const;
+
     public:
       kernel(modeDevice_t *modeDevice_,
              const std::string &name_,
@@ -52,6 +62,12 @@ namespace occa {
 
       void run() const;
 
+      // [args] has room for one more trailing argument
+      virtual void launch(const int argc,
+                          void **args) const;
+
+      void releaseLaunchOp(launchOp_t *op) const;
+
       void free();
 
       friend class device;
@@ -55,6 +55,11 @@ namespace occa {
                     const udim_t srcOffset,
                     const occa::properties &props);
 
+      void copy(void *dest,
+                const void *src,
+                const udim_t bytes,
+                const occa::properties &props) const;
+
       void free();
       void detach();
     };
@@ -0,0 +1,133 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_MODES_SERIAL_STREAM_HEADER
+#define OCCA_MODES_SERIAL_STREAM_HEADER
+
+#include <deque>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/kernelArg.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace serial {
+    class kernel;
+
+    //---[ Stream Ops ]-----------------
+    class streamOp_t {
+    public:
+      virtual ~streamOp_t();
+
+      virtual void run() = 0;
+
+      // Called by the stream worker once the op has run
+      virtual void release();
+    };
+
+    // Launch ops are owned by their kernel and reused across launches
+    class launchOp_t : public streamOp_t {
+    public:
+      const kernel &launchedKernel;
+      std::vector<kernelArgData> args;
+      std::vector<char> values;
+      std::vector<void*> vArgs;
+      int argc;
+
+      launchOp_t(const kernel &launchedKernel_);
+
+      void setup(const std::vector<kernelArg> &arguments);
+
+      virtual void run();
+      virtual void release();
+    };
+
+    class memcpyOp_t : public streamOp_t {
+    public:
+      void *dest;
+      const void *src;
+      udim_t bytes;
+
+      memcpyOp_t(void *dest_,
+                 const void *src_,
+                 const udim_t bytes_);
+
+      virtual void run();
+    };
+
+    // Set once all work queued before the tag has finished
+    // Finished tags are recycled, [queuedTime] matches the streamTag
+    //   handed out for the tag's current use
+    class tag_t {
+    public:
+      double queuedTime;
+      double tagTime;
+      bool done;
+
+      tag_t();
+    };
+
+    class tagOp_t : public streamOp_t {
+    public:
+      tag_t &tag;
+      condition &tagCondition;
+
+      tagOp_t(tag_t &tag_,
+              condition &tagCondition_);
+
+      virtual void run();
+    };
+    //==================================
+
+    //---[ Stream ]---------------------
+    // Ops are run in order by a worker thread owned by the stream
+    class stream {
+    public:
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_t tid;
+#else
+      HANDLE tid;
+#endif
+
+      // Guards ops, busy and stopping
+      condition queueCondition;
+      std::deque<streamOp_t*> ops;
+      bool busy;
+      bool stopping;
+
+      stream();
+
+      void free();
+
+      void enqueue(streamOp_t *op);
+      void finish();
+
+      bool isIdle();
+    };
+
+    void* streamLoop(void *args);
+    //==================================
+  }
+}
+
+#endif
@@ -20,9 +20,8 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 
-#if 0
-#  ifndef OCCA_MODES_THREADS_DEVICE_HEADER
-#  define OCCA_MODES_THREADS_DEVICE_HEADER
+#ifndef OCCA_MODES_THREADS_DEVICE_HEADER
+#define OCCA_MODES_THREADS_DEVICE_HEADER
 
 #include <occa/defines.hpp>
 #include <occa/mode/serial/device.hpp>
@@ -39,40 +38,30 @@ namespace occa {
       int threads;
       schedule_t schedule;
 
-#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-      pthread_t tid[50];
-#else
-      DWORD tid[50];
-#endif
-
-      std::queue<job_t> jobs[50];
-
-      mutex jobMutex;
+      mutable threadPool_t pool;
 
       device(const occa::properties &properties_);
       virtual ~device();
 
+      virtual void free();
+
       virtual void finish() const;
 
-      //---[ Stream ]-------------------
-      virtual streamTag tagStream() const;
-      virtual void waitFor(streamTag tag) const;
-      virtual double timeBetween(const streamTag &startTag,
-                                 const streamTag &endTag) const;
-      //================================
+      virtual hash_t kernelHash(const occa::properties &props) const;
 
       //---[ Kernel ]-------------------
-      virtual lang::kernelMetadataMap parseFile(const std::string &filename,
-                                                const std::string &outputFile,
-                                                const occa::properties &props);
-      //================================
+      virtual bool parseFile(const std::string &filename,
+                             const std::string &outputFile,
+                             const occa::properties &kernelProps,
+                             lang::kernelMetadataMap &metadata,
+                             strVector &dependencies);
 
-      //---[ Custom ]-------------------
-      void addJob(job_t &job);
+      virtual modeKernel_t* buildKernelFromBinary(const std::string &filename,
+                                                  const std::string &kernelName,
+                                                  const occa::properties &kernelProps);
       //================================
     };
   }
 }
 
-#  endif
 #endif
@@ -20,9 +20,8 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 
-#if 0
-#  ifndef OCCA_MODES_THREADS_KERNEL_HEADER
-#  define OCCA_MODES_THREADS_KERNEL_HEADER
+#ifndef OCCA_MODES_THREADS_KERNEL_HEADER
+#define OCCA_MODES_THREADS_KERNEL_HEADER
 
 #include <occa/defines.hpp>
 #include <occa/mode/threads/headers.hpp>
@@ -30,20 +29,22 @@
 
 namespace occa {
   namespace threads {
+    class device;
+
     class kernel : public serial::kernel {
     public:
-      int threads;
-
       kernel(modeDevice_t *modeDevice_,
              const std::string &name_,
              const std::string &sourceFilename_,
              const occa::properties &properties_);
       ~kernel();
 
-      void run() const;
+      virtual void launch(const int argc,
+                          void **args) const;
+
+      friend class device;
     };
   }
 }
 
-#  endif
 #endif
@@ -19,9 +19,9 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
-#if 0
-#  ifndef OCCA_MODES_THREADS_REGISTRATION_HEADER
-#  define OCCA_MODES_THREADS_REGISTRATION_HEADER
+
+#ifndef OCCA_MODES_THREADS_REGISTRATION_HEADER
+#define OCCA_MODES_THREADS_REGISTRATION_HEADER
 
 #include <occa/defines.hpp>
 #include <occa/mode.hpp>
@@ -39,10 +39,9 @@ namespace occa {
       void init();
     };
 
-    // extern occa::mode<threads::modeInfo,
-    //                   threads::device> mode;
+    extern occa::mode<threads::modeInfo,
+                      threads::device> mode;
   }
 }
 
-#  endif
 #endif
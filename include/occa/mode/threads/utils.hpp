@@ -24,7 +24,8 @@
 #define OCCA_MODES_THREADS_UTILS_HEADER
 
 #include <iostream>
-#include <queue>
+#include <deque>
+#include <vector>
 
 #include <occa/defines.hpp>
 #include <occa/mode/threads/headers.hpp>
@@ -32,6 +33,8 @@
 
 namespace occa {
   namespace threads {
+    class threadPool_t;
+
     //---[ Types ]----------------------
     enum schedule_t {
       compact, scatter, manual
@@ -39,36 +42,113 @@ namespace occa {
 
     std::string toString(schedule_t s);
 
+    // Entries of the trailing [_occa_thread_info] kernel argument
+    namespace threadInfo {
+      static const int loop  = 0;
+      static const int start = 1;
+      static const int end   = 2;
+      static const int count = 3;
+      static const int found = 4;
+      static const int size  = 5;
+    }
+
+    // Runs the iterations of one outer-most @outer loop
     class job_t {
     public:
-      int rank, count;
-      schedule_t schedule;
-
       functionPtr_t function;
+      trampolinePtr_t trampoline;
+      int argc;
+      void **args;
+      int loop;
 
-      int dims;
-      occa::dim inner, outer;
+      // Guarded by the pool's doneCondition
+      int pendingChunks;
 
-      std::vector<void*> args;
+      job_t(functionPtr_t function_,
+            trampolinePtr_t trampoline_,
+            const int argc_,
+            void **args_,
+            const int loop_);
+    };
+
+    class chunk_t {
+    public:
+      job_t *job;
+      int start, end;
 
-      job_t();
-      job_t(const job_t &k);
-      job_t& operator = (const job_t &k);
+      chunk_t();
+      chunk_t(job_t *job_,
+              const int start_,
+              const int end_);
     };
 
-    struct workerData_t {
-      int rank, count;
+    class worker_t {
+    public:
+      threadPool_t *pool;
+      int rank;
       int pinnedCore;
 
-      std::queue<job_t> *jobs;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_t tid;
+#else
+      HANDLE tid;
+#endif
+
+      // The owner pops from the front, thieves steal from the back
+      mutex chunkMutex;
+      std::deque<chunk_t> chunks;
+
+      std::vector<void*> args;
+
+      worker_t(threadPool_t *pool_,
+               const int rank_,
+               const int pinnedCore_);
+
+      void free();
+
+      void push(const chunk_t &chunk);
+      bool pop(chunk_t &chunk);
+      bool steal(chunk_t &chunk);
+
+      void run(const chunk_t &chunk);
+    };
+    //==================================
+
+    //---[ Pool ]-----------------------
+    class threadPool_t {
+    public:
+      std::vector<worker_t*> workers;
+      int chunksPerThread;
+
+      // Guards queuedChunks and stopping
+      condition workCondition;
+      int queuedChunks;
+      bool stopping;
+
+      // Guards activeJobs and job_t::pendingChunks
+      condition doneCondition;
+      int activeJobs;
+
+      threadPool_t();
+
+      void start(const std::vector<int> &pinnedCores,
+                 const int chunksPerThread_);
+      void stop();
+
+      int size() const;
+
+      void run(job_t &job,
+               const int iterations);
+      void finish();
 
-      mutex *jobMutex;
+      bool getChunk(worker_t &worker,
+                    chunk_t &chunk);
+      void chunkFinished(const chunk_t &chunk);
     };
     //==================================
 
     //---[ Functions ]------------------
-    void* limbo(void *args);
-    void run(job_t &job);
+    void* workerLoop(void *args);
     //==================================
   }
 }
@@ -27,6 +27,7 @@
 #include <occa/tools/json.hpp>
 #include <occa/tools/lex.hpp>
 #include <occa/tools/misc.hpp>
+#include <occa/tools/profiler.hpp>
 #include <occa/tools/properties.hpp>
 #include <occa/tools/string.hpp>
 #include <occa/tools/styling.hpp>
@@ -29,7 +29,7 @@
 #include <occa/types.hpp>
 
 namespace occa {
-  // Uses FNV hashing
+  // 256-bit hash, stored as 8 ints for toString() compatibility
   class hash_t {
   public:
     bool initialized;
@@ -66,6 +66,36 @@ namespace occa {
   };
   std::ostream& operator << (std::ostream &out, const hash_t &hash);
 
+  //---[ Hasher ]-----------------------
+  // Incremental hash over 32-byte stripes using 4 independent 64-bit
+  //   lanes, so data can be hashed in chunks without extra copies.
+  //   Feeding the same bytes in any chunking gives the same hash_t
+  class hasher_t {
+  private:
+    uint64_t lanes[4];
+    unsigned char stripe[32];
+    int stripeBytes;
+    udim_t totalBytes;
+
+    static uint64_t rotl(const uint64_t x, const int r);
+    static uint64_t readWord(const unsigned char *c);
+    static uint64_t mixWord(uint64_t lane, const uint64_t word);
+    static uint64_t avalanche(uint64_t h);
+
+    void consumeStripe(const unsigned char *c);
+
+  public:
+    hasher_t();
+
+    void clear();
+
+    hasher_t& update(const void *ptr, udim_t bytes);
+    hasher_t& update(const std::string &str);
+
+    hash_t digest() const;
+  };
+  //====================================
+
   hash_t hash(const void *ptr, udim_t bytes);
 
   template <class TM>
@@ -83,7 +113,27 @@ namespace occa {
 
   hash_t hash(const char *c);
   hash_t hash(const std::string &str);
+
+  //---[ File Stamp ]-------------------
+  // File hashes are reused until the file's size or modified time changes
+  class fileStamp_t {
+  public:
+    udim_t bytes;
+    int64_t modifiedTime;
+    int64_t modifiedTimeNs;
+    hash_t hash;
+
+    fileStamp_t();
+
+    bool load(const std::string &filename);
+
+    bool sameModification(const fileStamp_t &other) const;
+  };
+  //====================================
+
+  fileStamp_t fileStamp(const std::string &filename);
   hash_t hashFile(const std::string &filename);
+  hash_t hashFileContents(const std::string &filename);
 }
 
 #endif
@@ -0,0 +1,127 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_TOOLS_PROFILER_HEADER
+#define OCCA_TOOLS_PROFILER_HEADER
+
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/types.hpp>
+#include <occa/tools/json.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace profileCategory {
+    extern const std::string kernel;
+    extern const std::string malloc;
+    extern const std::string free;
+    extern const std::string copy;
+    extern const std::string sync;
+    extern const std::string build;
+    extern const std::string parse;
+    extern const std::string compile;
+    extern const std::string load;
+  }
+
+  class profileEvent_t {
+  public:
+    std::string category;
+    std::string name;
+    double start, end;
+    udim_t bytes;
+    int threadId;
+
+    profileEvent_t(const std::string &category_,
+                   const std::string &name_,
+                   const double start_,
+                   const double end_,
+                   const udim_t bytes_);
+  };
+
+  //---[ profiler_t ]-------------------
+  // Enabled through the OCCA_PROFILE environment variable or
+  //   the 'profile' device property
+  //
+  // OCCA_PROFILE=<file> also writes a Chrome trace on exit
+  //   (chrome://tracing or https://ui.perfetto.dev)
+  class profiler_t {
+  private:
+    volatile bool enabled;
+    double startTime;
+    std::string outputFilename;
+
+    mutex eventMutex;
+    std::vector<profileEvent_t> events;
+
+  public:
+    profiler_t();
+    ~profiler_t();
+
+    inline bool isEnabled() const {
+      return enabled;
+    }
+
+    void enable();
+    void disable();
+    void clear();
+
+    int size();
+
+    void record(const std::string &category,
+                const std::string &name,
+                const double start,
+                const double end,
+                const udim_t bytes = 0);
+
+    // Per-category, per-name counts and timings
+    json getStats();
+
+    // Chrome trace format
+    json toJson();
+
+    void write(const std::string &filename);
+  };
+
+  extern profiler_t profiler;
+  //====================================
+
+  //---[ profileScope_t ]---------------
+  // Records an event from construction to destruction
+  class profileScope_t {
+  private:
+    bool enabled;
+    std::string category;
+    std::string name;
+    double start;
+    udim_t bytes;
+
+  public:
+    profileScope_t(const std::string &category_,
+                   const std::string &name_,
+                   const udim_t bytes_ = 0);
+    ~profileScope_t();
+  };
+  //====================================
+}
+
+#endif
@@ -33,6 +33,7 @@
 
 namespace occa {
   typedef void (*functionPtr_t)(...);
+  typedef void (*trampolinePtr_t)(void **args);
 
   namespace sys {
     namespace vendor {
@@ -87,6 +88,34 @@ namespace occa {
     void pinToCore(const int core);
     //==================================
 
+    //---[ Processes ]------------------
+    // Quotes arguments with spaces or quotes, used for logging and shells
+    std::string joinCommand(const strVector &args);
+
+    // Splits arguments by whitespace, keeping quoted arguments together
+    strVector splitCommand(const std::string &cmdline);
+
+    // Splits arguments the way /bin/sh would, expanding variables,
+    //   command substitutions and globs
+    //   Falls back to splitCommand when expansion isn't available or fails
+    strVector expandCommand(const std::string &cmdline);
+
+    // The compiler and its flags are expanded with expandCommand
+    //   Commands with an environment script run through a shell
+    strVector compilerCommand(const std::string &compiler,
+                              const std::string &compilerFlags,
+                              const std::string &compilerEnvScript,
+                              const strVector &args);
+
+    // Runs [args] without a shell, returning the exit status
+    //   stdout and stderr are captured in [output]
+    //   Processes running longer than [timeout] seconds are killed
+    //   and return -1, as do processes that can't be started
+    int runProcess(const strVector &args,
+                   std::string &output,
+                   const double timeout = -1);
+    //==================================
+
     //---[ Processor Info ]-------------
     std::string getFieldFrom(const std::string &command,
                              const std::string &field);
@@ -118,6 +147,10 @@ namespace occa {
                         const std::string &functionName,
                         const io::lock_t &lock = io::lock_t());
 
+    // Returns NULL instead of erroring when the symbol is missing
+    functionPtr_t dlsymIfExists(void *dlHandle,
+                                const std::string &functionName);
+
     void dlclose(void *dlHandle);
 
     void runFunction(functionPtr_t f, const int argc, void **args);
@@ -181,6 +214,47 @@ namespace occa {
     void lock();
     void unlock();
   };
+
+  class condition {
+  public:
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_mutex_t mutexHandle;
+    pthread_cond_t conditionHandle;
+#else
+    CRITICAL_SECTION mutexHandle;
+    CONDITION_VARIABLE conditionHandle;
+#endif
+
+    condition();
+    void free();
+
+    void lock();
+    void unlock();
+
+    // Must be called while holding the lock
+    void wait();
+    void signal();
+    void broadcast();
+  };
+
+  namespace sys {
+    // Limits how many processes sys::runProcess runs at once
+    //   Set with [OCCA_COMPILE_JOBS], defaulting to the core count
+    class processLimit_t {
+    public:
+      condition slotCondition;
+      int running;
+      int maxRunning;
+
+      processLimit_t();
+      ~processLimit_t();
+
+      static processLimit_t& get();
+
+      void acquire();
+      void release();
+    };
+  }
 }
 
 #endif
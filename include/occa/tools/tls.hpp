@@ -40,6 +40,10 @@ namespace occa {
   private:
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
     pthread_key_t pkey;
+
+    // Other threads start with a default value, freed when they exit
+    TM* threadValue() const;
+    static void freeValue(void *ptr);
 #else
     __declspec(thread) TM value_;
 #endif
@@ -23,7 +23,7 @@ namespace occa {
   template <class TM>
   tls<TM>::tls(const TM &val) {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    pthread_key_create(&pkey, NULL);
+    pthread_key_create(&pkey, freeValue);
     pthread_setspecific(pkey, new TM(val));
 #else
     value_ = val;
@@ -34,7 +34,7 @@ namespace occa {
   template <class TM2>
   tls<TM>::tls(const tls<TM2> &t) {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    pthread_key_create(&pkey, NULL);
+    pthread_key_create(&pkey, freeValue);
     pthread_setspecific(pkey, new TM(t.value()));
 #else
     value_ = t.value_;
@@ -77,7 +77,7 @@ namespace occa {
   template <class TM>
   TM& tls<TM>::value() {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    return *((TM*) pthread_getspecific(pkey));
+    return *(threadValue());
 #else
     return value_;
 #endif
@@ -86,12 +86,29 @@ namespace occa {
   template <class TM>
   const TM& tls<TM>::value() const {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    return *((TM*) pthread_getspecific(pkey));
+    return *(threadValue());
 #else
     return value_;
 #endif
   }
 
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+  template <class TM>
+  TM* tls<TM>::threadValue() const {
+    TM *ptr = (TM*) pthread_getspecific(pkey);
+    if (!ptr) {
+      ptr = new TM();
+      pthread_setspecific(pkey, ptr);
+    }
+    return ptr;
+  }
+
+  template <class TM>
+  void tls<TM>::freeValue(void *ptr) {
+    delete (TM*) ptr;
+  }
+#endif
+
   template <class TM>
   tls<TM>::operator TM () {
     return value();
@@ -0,0 +1,75 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#ifndef OCCA_TUNER_HEADER
+#define OCCA_TUNER_HEADER
+
+#include <occa/defines.hpp>
+#include <occa/types.hpp>
+#include <occa/device.hpp>
+#include <occa/kernel.hpp>
+#include <occa/tools/properties.hpp>
+
+namespace occa {
+  //---[ kernelTuner ]------------------
+  // Picks the fastest TUNE() options in @tile loops, for example
+  //   for (...; @tile(TUNE(16, 32, 64), @outer, @inner))
+  //
+  // Each variant is timed with the arguments bound in a kernelFrame
+  //   and the winner is stored in the cache per device, source,
+  //   kernel and properties so later runs skip tuning
+  class kernelTuner {
+  private:
+    std::string filename;
+    std::string kernelName;
+    occa::properties props;
+
+  public:
+    kernelTuner(const std::string &filename_,
+                const std::string &kernelName_,
+                const occa::properties &props_ = occa::properties());
+
+    hash_t hash(occa::device device) const;
+    std::string getCacheFilename(occa::device device) const;
+
+    bool isTuned(occa::device device) const;
+    intVector getTunedOptions(occa::device device) const;
+
+    // Builds the tuned kernel if available, otherwise the first options
+    occa::kernel build(occa::device device) const;
+
+    occa::kernel build(occa::device device,
+                       const intVector &options) const;
+
+    // Times every combination of options with the frame's arguments
+    //   Note: Kernels are launched with the same arguments several times
+    occa::kernel tune(occa::device device,
+                      kernelFrame frame,
+                      const int iterations = 5) const;
+
+    static bool nextOptions(const std::vector<strVector> &tunables,
+                            intVector &options);
+  };
+  //====================================
+}
+
+#endif
@@ -28,18 +28,19 @@
 
 #include <occa/defines.hpp>
 #include <occa/types.hpp>
+#include <occa/tools/sys.hpp>
 
 namespace occa {
   class device;
   class memory;
   class modeMemory_t;
   class ptrRange;
+  class uvaIndex;
 
   typedef std::map<ptrRange, occa::modeMemory_t*> ptrRangeMap;
   typedef std::vector<occa::modeMemory_t*>        memoryVector;
 
-  extern ptrRangeMap uvaMap;
-  extern memoryVector uvaStaleMemory;
+  extern uvaIndex uvaMap;
 
   //---[ ptrRange ]---------------------
   class ptrRange {
@@ -62,6 +63,100 @@ namespace occa {
                              const ptrRange &range);
   //====================================
 
+  //---[ uvaIndex ]---------------------
+  // Interval index from UVA pointers to their memory, stored as a
+  //   sorted list of fixed-size chunks.
+  //   Updates are serialized and publish a new snapshot that shares
+  //   all untouched chunks, so lookups never take a lock.
+  //   Lookups register in the current epoch, and replaced snapshots
+  //   are freed by later updates once the epoch they were replaced in
+  //   has no lookups left
+  class uvaIndex {
+  public:
+    static const int chunkCapacity = 128;
+    static const int readerSlots   = 16;
+
+    class entry_t {
+    public:
+      char *start, *end;
+      occa::modeMemory_t *mem;
+    };
+
+    class chunk_t {
+    public:
+      int size;
+      entry_t entries[chunkCapacity];
+    };
+
+    class snapshot_t {
+    public:
+      int chunkCount;
+      int entryCount;
+      chunk_t **chunks;
+    };
+
+    // Padded to avoid false sharing between reader threads
+    //   Readers are counted by the parity of their epoch
+    class readerSlot_t {
+    public:
+      int readers[2];
+      char padding[64 - (2 * sizeof(int))];
+    };
+
+    class retired_t {
+    public:
+      std::vector<snapshot_t*> snapshots;
+      std::vector<chunk_t*> chunks;
+
+      bool isEmpty() const;
+      void swap(retired_t &other);
+      void free();
+    };
+
+  private:
+    snapshot_t *snapshot;
+    int epoch;
+    mutable readerSlot_t slots[readerSlots];
+
+    mutex writeMutex;
+    // Replaced in the current epoch
+    retired_t retired;
+    // Replaced in the previous epoch, waiting for its readers to leave
+    retired_t pending;
+
+    static int findChunk(const snapshot_t *snap, const char *ptr);
+    static int findEntry(const chunk_t *chunk, const char *ptr);
+    static bool contains(const entry_t &entry, const char *ptr);
+
+    bool hasReaders(const int parity) const;
+
+    void replaceChunk(const int chunkIndex,
+                      const entry_t *entries,
+                      const int entryCount,
+                      const int entryDelta);
+    void reclaim();
+
+  public:
+    uvaIndex();
+    ~uvaIndex();
+
+    // Snapshots seen between these calls stay allocated
+    readerSlot_t& startReading(int &parity) const;
+    void stopReading(readerSlot_t &slot,
+                     const int parity) const;
+
+    occa::modeMemory_t* find(const void *ptr) const;
+    size_t size() const;
+
+    // Replaced snapshots that aren't freed yet
+    size_t retiredSize();
+
+    void insert(const ptrRange &range,
+                occa::modeMemory_t *mem);
+    void erase(const void *ptr);
+  };
+  //====================================
+
 
   //---[ UVA ]--------------------------
   occa::modeMemory_t* uvaToMemory(void *ptr);
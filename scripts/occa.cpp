@@ -21,10 +21,17 @@
  */
 
 #include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
 #include <occa.hpp>
+#include <occa/tools/exception.hpp>
 #include <occa/lang/mode/serial.hpp>
 #include <occa/lang/mode/openmp.hpp>
+#include <occa/lang/mode/threads.hpp>
 #include <occa/lang/mode/opencl.hpp>
 #include <occa/lang/mode/cuda.hpp>
 #include <occa/lang/mode/hip.hpp>
@@ -204,6 +211,8 @@ bool runTranslate(const json &args) {
     parser = new lang::okl::serialParser(kernelProps);
   } else if (mode == "OpenMP") {
     parser = new lang::okl::openmpParser(kernelProps);
+  } else if (mode == "Threads") {
+    parser = new lang::okl::threadsParser(kernelProps);
   } else if (mode == "OpenCL") {
     parser = new lang::okl::openclParser(kernelProps);
   } else if (mode == "CUDA") {
@@ -276,6 +285,233 @@ bool runCompile(const json &args) {
   return true;
 }
 
+//---[ Build ]--------------------------
+class buildJob_t {
+public:
+  std::string filename;
+  std::string kernelName;
+  properties deviceProps;
+  properties kernelProps;
+
+  int pid;
+  int outputFd;
+
+  bool success;
+  double parseTime;
+  double compileTime;
+  double totalTime;
+};
+
+void getOptionPropertiesMatrix(const json &opt,
+                               std::vector<properties> &matrix) {
+  matrix.clear();
+  for (int i = 0; i < opt.size(); ++i) {
+    matrix.push_back(properties((std::string) opt[i]));
+  }
+  if (!matrix.size()) {
+    matrix.push_back(properties());
+  }
+}
+
+// Runs in a forked process, results are sent back through [fd]
+void buildJobKernel(const buildJob_t &job, const int fd) {
+  bool success = true;
+  double parseTime = 0, compileTime = 0;
+
+  const double start = sys::currentTime();
+  try {
+    device device(job.deviceProps);
+    kernel k = device.buildKernel(job.filename,
+                                  job.kernelName,
+                                  job.kernelProps);
+    success = k.isInitialized();
+    if (success) {
+      parseTime   = k.properties().get("build/parse_time", 0.0);
+      compileTime = k.properties().get("build/compile_time", 0.0);
+    }
+  } catch (exception &e) {
+    std::cerr << e << '\n';
+    success = false;
+  }
+  const double totalTime = sys::currentTime() - start;
+
+  std::stringstream ss;
+  ss << success << ' ' << parseTime << ' ' << compileTime << ' ' << totalTime;
+  const std::string result = ss.str();
+  const bool written = (::write(fd, result.c_str(), result.size())
+                        == (ssize_t) result.size());
+  ::close(fd);
+  ::_exit(!(success && written));
+}
+
+// Returns false if the job couldn't be started
+bool startBuildJob(buildJob_t &job) {
+  job.pid = -1;
+  job.outputFd = -1;
+
+  int fds[2];
+  if (::pipe(fds)) {
+    printError("Unable to create pipe for build job");
+    return false;
+  }
+
+  std::cout.flush();
+  std::cerr.flush();
+
+  job.pid = ::fork();
+  if (job.pid < 0) {
+    printError("Unable to fork build job");
+    ::close(fds[0]);
+    ::close(fds[1]);
+    return false;
+  }
+  if (job.pid == 0) {
+    ::close(fds[0]);
+    buildJobKernel(job, fds[1]);
+  }
+  ::close(fds[1]);
+  job.outputFd = fds[0];
+  return true;
+}
+
+void finishBuildJob(buildJob_t &job) {
+  job.success = false;
+  job.parseTime = job.compileTime = job.totalTime = 0;
+
+  // Results fit in the pipe buffer, read them after the process exits
+  if (job.outputFd >= 0) {
+    char buffer[256];
+    const ssize_t bytes = ::read(job.outputFd, buffer, sizeof(buffer) - 1);
+    ::close(job.outputFd);
+    job.outputFd = -1;
+
+    if (bytes > 0) {
+      buffer[bytes] = '\0';
+      int success = 0;
+      std::stringstream ss(buffer);
+      ss >> success >> job.parseTime >> job.compileTime >> job.totalTime;
+      job.success = success;
+    }
+  }
+  job.pid = -1;
+
+  std::cout << (job.success ? green("Built") : red("Failed"))
+            << " [" << job.kernelName << "] from ["
+            << io::shortname(job.filename) << "]\n"
+            << "    device : " << job.deviceProps.dump(0) << '\n'
+            << "    kernel : " << job.kernelProps.dump(0) << '\n'
+            << "    parse  : " << job.parseTime << " s\n"
+            << "    compile: " << job.compileTime << " s\n"
+            << "    total  : " << job.totalTime << " s\n";
+}
+
+bool runBuild(const json &args) {
+  const json &options = args["options"];
+  const json &arguments = args["arguments"];
+
+  int workers = sys::getCoreCount();
+  if (options["jobs"].isString()) {
+    workers = std::atoi(((std::string) options["jobs"]).c_str());
+  }
+  if (workers < 1) {
+    workers = 1;
+  }
+
+  std::vector<properties> deviceMatrix, kernelMatrix;
+  getOptionPropertiesMatrix(options["device-props"], deviceMatrix);
+  getOptionPropertiesMatrix(options["kernel-props"], kernelMatrix);
+
+  // Only add fields that were passed, kernel properties need to match
+  //   the ones used at runtime to hit the same cache entries
+  properties sharedKernelProps;
+  if (options["include-path"].size()) {
+    sharedKernelProps["include_paths"] = options["include-path"];
+  }
+  if (options["define"].size()) {
+    sharedKernelProps["defines"] = getOptionDefines(options["define"]);
+  }
+
+  // Expand FILE:KERNEL arguments across the property matrix
+  std::vector<buildJob_t> jobs;
+  for (int i = 0; i < arguments.size(); ++i) {
+    const std::string arg = arguments[i];
+    const size_t colon = arg.rfind(':');
+    if ((colon == std::string::npos) || (colon == 0)) {
+      printError("Kernels must be given as FILE:KERNEL, found [" + arg + "]");
+      ::exit(1);
+    }
+
+    buildJob_t job;
+    job.filename = arg.substr(0, colon);
+    job.kernelName = arg.substr(colon + 1);
+    if (!io::exists(job.filename)) {
+      printError("File [" + job.filename + "] doesn't exist" );
+      ::exit(1);
+    }
+
+    for (int d = 0; d < (int) deviceMatrix.size(); ++d) {
+      for (int k = 0; k < (int) kernelMatrix.size(); ++k) {
+        job.deviceProps = deviceMatrix[d];
+        job.kernelProps = sharedKernelProps + kernelMatrix[k];
+        jobs.push_back(job);
+      }
+    }
+  }
+
+  const int jobCount = (int) jobs.size();
+  int nextJob = 0, running = 0, failed = 0;
+  const double start = sys::currentTime();
+
+  while ((nextJob < jobCount) || running) {
+    if ((nextJob < jobCount) && (running < workers)) {
+      buildJob_t &job = jobs[nextJob++];
+      if (startBuildJob(job)) {
+        ++running;
+      } else {
+        finishBuildJob(job);
+        ++failed;
+      }
+      continue;
+    }
+
+    int status;
+    const int pid = ::wait(&status);
+    if (pid < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      // No children are left to wait on, fail the jobs still running
+      for (int i = 0; i < nextJob; ++i) {
+        if (jobs[i].pid > 0) {
+          finishBuildJob(jobs[i]);
+          failed += !jobs[i].success;
+          --running;
+        }
+      }
+      continue;
+    }
+
+    for (int i = 0; i < nextJob; ++i) {
+      if (jobs[i].pid == pid) {
+        finishBuildJob(jobs[i]);
+        failed += !jobs[i].success;
+        --running;
+        break;
+      }
+    }
+  }
+
+  std::cout << "Built " << (jobCount - failed) << '/' << jobCount
+            << " kernels with " << workers << " workers in "
+            << (sys::currentTime() - start) << " s\n";
+
+  if (failed) {
+    ::exit(1);
+  }
+  return true;
+}
+//======================================
+
 bool runEnv(const json &args) {
   std::cout << "  Basic:\n"
             << "    - OCCA_DIR                   : " << envEcho("OCCA_DIR") << "\n"
@@ -425,6 +661,35 @@ int main(const int argc, const char **argv) {
                  "Kernel name",
                  true);
 
+  cli::command buildCommand;
+  buildCommand
+    .withName("build")
+    .withCallback(runBuild)
+    .withDescription("Compile kernels ahead of time in parallel, building every"
+                     " combination of device and kernel properties")
+    .addOption(cli::option('j', "jobs",
+                           "Number of worker processes (default: core count)")
+               .withArg())
+    .addOption(cli::option('d', "device-props",
+                           "Device properties, each one adds a device to build for")
+               .reusable()
+               .withArg())
+    .addOption(cli::option('k', "kernel-props",
+                           "Kernel properties, each one adds a kernel variant to build")
+               .reusable()
+               .withArg())
+    .addOption(cli::option('I', "include-path",
+                           "Add additional include path")
+               .reusable()
+               .withArg())
+    .addOption(cli::option('D', "define",
+                           "Add additional define")
+               .reusable()
+               .withArg())
+    .addRepetitiveArgument("KERNEL",
+                           "Kernels to build, given as FILE:KERNEL",
+                           true);
+
   cli::command envCommand;
   envCommand
     .withName("env")
@@ -464,6 +729,7 @@ int main(const int argc, const char **argv) {
     .addCommand(clearCommand)
     .addCommand(translateCommand)
     .addCommand(compileCommand)
+    .addCommand(buildCommand)
     .addCommand(envCommand)
     .addCommand(infoCommand)
     .addCommand(modesCommand)
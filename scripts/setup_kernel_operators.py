@@ -66,7 +66,7 @@ def operator_args(N, indent, argtype):
 def array_args(N, indent):
     content = ''
     for n in range(1, N + 1):
-        content += 'arg{n}'.format(n=n)
+        content += '&arg{n}'.format(n=n)
         if n < N:
             if n % 10:
                 content += ', '
@@ -106,7 +106,8 @@ def runFunctionFromArgument(N):
 @to_file('include/occa/kernelOperators.hpp')
 def operatorDeclarations(N):
     return '\n\n'.join(
-        operatorDeclaration(n) for n in range(N + 1)
+        [operatorDeclaration(n) for n in range(N + 1)] +
+        [bindDeclaration(n) for n in range(N + 1)]
     )
 
 
@@ -119,10 +120,20 @@ def operatorDeclaration(N):
     return content
 
 
+def bindDeclaration(N):
+    content = 'kernelFrame bind('
+    indent = ' ' * len(content)
+    content += operator_args(N, indent, 'const kernelArg &')
+    content += ') const;'
+
+    return content
+
+
 @to_file('src/kernelOperators.cpp')
 def operatorDefinitions(N):
     return '\n'.join(
-        operatorDefinition(n) for n in range(N + 1)
+        [operatorDefinition(n) for n in range(N + 1)] +
+        [bindDefinition(n) for n in range(N + 1)]
     )
 
 
@@ -132,19 +143,17 @@ def operatorDefinition(N):
     content += operator_args(N, indent, 'const kernelArg &')
     if N > 0:
         content += ''') const {{
-  kernelArg args[] = {{
+  const kernelArg *args[] = {{
     {array_args}
   }};
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve({N});
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + {N});
+  setArguments(args, {N});
   run();
 }}
 '''.format(N=N,
            array_args=array_args(N, ' ' * 4))
     else:
         content += ''') const {
-  modeKernel->arguments.clear();
+  setArguments(NULL, 0);
   run();
 }
 '''
@@ -152,6 +161,30 @@ def operatorDefinition(N):
     return content
 
 
+def bindDefinition(N):
+    content = 'kernelFrame kernel::bind('
+    indent = ' ' * len(content)
+    content += operator_args(N, indent, 'const kernelArg &')
+    if N > 0:
+        content += ''') const {{
+  const kernelArg *args[] = {{
+    {array_args}
+  }};
+  kernelFrame frame(*this);
+  frame.setArguments(args, {N});
+  return frame;
+}}
+'''.format(N=N,
+           array_args=array_args(N, ' ' * 4))
+    else:
+        content += ''') const {
+  return kernelFrame(*this);
+}
+'''
+
+    return content
+
+
 if __name__ == '__main__':
     runFunctionFromArguments(MAX_ARGS)
     operatorDeclarations(MAX_ARGS)
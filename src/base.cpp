@@ -116,6 +116,13 @@ namespace occa {
     return getDevice().buildKernelFromBinary(filename, kernelName, props);
   }
 
+  kernelFuture buildKernelAsync(const std::string &filename,
+                                const std::string &kernelName,
+                                const occa::properties &props) {
+
+    return getDevice().buildKernelAsync(filename, kernelName, props);
+  }
+
   //---[ Memory Functions ]-------------
   occa::memory malloc(const dim_t bytes,
                       const void *src,
@@ -135,11 +142,8 @@ namespace occa {
               const dim_t bytes,
               const occa::properties &props) {
 
-    ptrRangeMap::iterator srcIt  = uvaMap.find(const_cast<void*>(src));
-    ptrRangeMap::iterator destIt = uvaMap.find(dest);
-
-    occa::modeMemory_t *srcMem  = ((srcIt  != uvaMap.end()) ? (srcIt->second)  : NULL);
-    occa::modeMemory_t *destMem = ((destIt != uvaMap.end()) ? (destIt->second) : NULL);
+    occa::modeMemory_t *srcMem  = uvaMap.find(src);
+    occa::modeMemory_t *destMem = uvaMap.find(dest);
 
     const udim_t srcOff  = (srcMem
                             ? (((char*) src)  - srcMem->uvaPtr)
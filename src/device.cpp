@@ -22,8 +22,10 @@
 
 #include <occa/device.hpp>
 #include <occa/base.hpp>
+#include <occa/future.hpp>
 #include <occa/mode.hpp>
 #include <occa/tools/env.hpp>
+#include <occa/tools/profiler.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/io.hpp>
 
@@ -33,8 +35,17 @@ namespace occa {
     mode = (std::string) properties_["mode"];
     properties = properties_;
 
+    staleMemory = NULL;
+    bytesSyncedToDevice = 0;
+    bytesSyncedToHost = 0;
+
     currentStream = NULL;
     bytesAllocated = 0;
+    maxBytesAllocated = 0;
+    bytesPooled = 0;
+
+    capturingGraph = NULL;
+    buildJobs = 0;
   }
 
   modeDevice_t::~modeDevice_t() {
@@ -66,17 +77,33 @@ namespace occa {
       memoryRing.clear();
     }
 
+    // Free all graph objects
+    graph_t *graphHead = (graph_t*) graphRing.head;
+    if (graphHead) {
+      graph_t *ptr = graphHead;
+      do {
+        graph_t *nextPtr = (graph_t*) ptr->rightRingEntry;
+        // Remove modeDevice to prevent messing with this ring
+        ptr->modeDevice = NULL;
+        delete ptr;
+        ptr = nextPtr;
+      } while (ptr != graphHead);
+      graphRing.clear();
+    }
+
     // Null all wrappers
     device *deviceHead = (device*) deviceRing.head;
     if (deviceHead) {
-      device *ptr = deviceHead;
-      do {
-        device *nextPtr = (device*) ptr->rightRingEntry;
+      // Unlink entries after the head until it's the only one left
+      while (!deviceHead->isAlone()) {
+        device *ptr = (device*) deviceHead->rightRingEntry;
         ptr->modeDevice = NULL;
         ptr->removeRef();
-        ptr = nextPtr;
-      } while (ptr != deviceHead);
+      }
+      deviceHead->modeDevice = NULL;
     }
+
+    kernelMutex.free();
   }
 
   void modeDevice_t::dontUseRefs() {
@@ -96,11 +123,15 @@ namespace occa {
   }
 
   void modeDevice_t::addKernelRef(modeKernel_t *ker) {
+    kernelMutex.lock();
     kernelRing.addRef(ker);
+    kernelMutex.unlock();
   }
 
   void modeDevice_t::removeKernelRef(modeKernel_t *ker) {
+    kernelMutex.lock();
     kernelRing.removeRef(ker);
+    kernelMutex.unlock();
   }
 
   void modeDevice_t::addMemoryRef(modeMemory_t *mem) {
@@ -111,6 +142,138 @@ namespace occa {
     memoryRing.removeRef(mem);
   }
 
+  void modeDevice_t::addGraphRef(graph_t *graph_) {
+    graphRing.addRef(graph_);
+  }
+
+  void modeDevice_t::removeGraphRef(graph_t *graph_) {
+    graphRing.removeRef(graph_);
+  }
+
+  void modeDevice_t::addBytesAllocated(const udim_t bytes) {
+    bytesAllocated += bytes;
+    if (maxBytesAllocated < bytesAllocated) {
+      maxBytesAllocated = bytesAllocated;
+    }
+  }
+
+  udim_t modeDevice_t::poolBlockSize(const udim_t bytes) {
+    udim_t blockBytes = 256;
+    while (blockBytes < bytes) {
+      blockBytes <<= 1;
+    }
+    if (blockBytes == 256) {
+      return blockBytes;
+    }
+    // Split each power of two into 4 size classes to bound the unused tail
+    const udim_t step = (blockBytes >> 3);
+    udim_t classBytes = (blockBytes >> 1) + step;
+    while (classBytes < bytes) {
+      classBytes += step;
+    }
+    return classBytes;
+  }
+
+  modeMemory_t* modeDevice_t::getPooledMemory(const udim_t blockBytes,
+                                              const occa::properties &props) {
+    // Only hand out blocks allocated with the same properties
+    //   (e.g. mapped, managed or pinned host memory)
+    pooledMemoryMapIterator it = pooledMemory.find(
+      pooledMemoryKey(blockBytes, occa::hash(props))
+    );
+    if ((it == pooledMemory.end()) ||
+        !it->second.size()) {
+      return NULL;
+    }
+    modeMemory_t *mem = it->second.back();
+    it->second.pop_back();
+    bytesPooled -= blockBytes;
+    return mem;
+  }
+
+  void modeDevice_t::addPooledMemory(modeMemory_t *mem) {
+    // Reset UVA state so the block can be handed out again
+    removeStaleMemory(mem);
+    mem->memInfo = uvaFlag::none;
+    mem->uvaPtr = NULL;
+    mem->size = poolBlockSize(mem->size);
+
+    pooledMemory[pooledMemoryKey(mem->size,
+                                 occa::hash(mem->properties))].push_back(mem);
+    bytesPooled += mem->size;
+  }
+
+  void modeDevice_t::trimMemoryPool() {
+    pooledMemoryMapIterator it = pooledMemory.begin();
+    while (it != pooledMemory.end()) {
+      memoryVector &blocks = it->second;
+      const int blockCount = (int) blocks.size();
+      for (int i = 0; i < blockCount; ++i) {
+        blocks[i]->free();
+        delete blocks[i];
+      }
+      ++it;
+    }
+    pooledMemory.clear();
+    bytesPooled = 0;
+  }
+
+  void modeDevice_t::addStaleMemory(modeMemory_t *mem) {
+    if (mem->isStale()) {
+      return;
+    }
+    mem->leftStaleEntry  = NULL;
+    mem->rightStaleEntry = staleMemory;
+    if (staleMemory) {
+      staleMemory->leftStaleEntry = mem;
+    }
+    staleMemory = mem;
+    mem->memInfo |= uvaFlag::isStale;
+  }
+
+  void modeDevice_t::removeStaleMemory(modeMemory_t *mem) {
+    if (!mem->isStale()) {
+      return;
+    }
+    modeMemory_t *left  = mem->leftStaleEntry;
+    modeMemory_t *right = mem->rightStaleEntry;
+    if (left) {
+      left->rightStaleEntry = right;
+    } else {
+      staleMemory = right;
+    }
+    if (right) {
+      right->leftStaleEntry = left;
+    }
+    mem->leftStaleEntry  = NULL;
+    mem->rightStaleEntry = NULL;
+    mem->memInfo &= ~uvaFlag::isStale;
+  }
+
+  void modeDevice_t::syncStaleMemory() {
+    if (!staleMemory) {
+      return;
+    }
+    // Queue every copy before waiting so they overlap on the stream
+    occa::properties asyncProps;
+    asyncProps["async"] = true;
+
+    modeMemory_t *mem = staleMemory;
+    while (mem) {
+      modeMemory_t *nextMem = mem->rightStaleEntry;
+
+      mem->copyTo(mem->uvaPtr, mem->size, 0, asyncProps);
+      bytesSyncedToHost += mem->size;
+
+      mem->leftStaleEntry  = NULL;
+      mem->rightStaleEntry = NULL;
+      mem->memInfo &= ~(uvaFlag::inDevice |
+                        uvaFlag::isStale);
+      mem = nextMem;
+    }
+    staleMemory = NULL;
+  }
+
   hash_t modeDevice_t::versionedHash() const {
     return (occa::hash(settings()["version"])
             ^ hash());
@@ -119,7 +282,8 @@ namespace occa {
   void modeDevice_t::writeKernelBuildFile(const std::string &filename,
                                           const hash_t &kernelHash,
                                           const occa::properties &kernelProps,
-                                          const lang::kernelMetadataMap &metadataMap) const {
+                                          const lang::kernelMetadataMap &metadataMap,
+                                          const strVector &dependencies) const {
     occa::properties infoProps;
 
     infoProps["device"]       = properties;
@@ -134,6 +298,10 @@ namespace occa {
       ++kIt;
     }
 
+    // Included files aren't part of the kernel hash, the cache
+    //   checks them before reusing a binary
+    io::setDependencyProps(infoProps["dependencies"], dependencies);
+
     io::writeBuildFile(filename, kernelHash, infoProps);
   }
 
@@ -164,7 +332,9 @@ namespace occa {
       return;
     }
     cachedKernelMapIterator it = cachedKernels.find(getKernelHash(kernel));
-    if (it != cachedKernels.end()) {
+    // Only drop the entry if it still points to [kernel]
+    if ((it != cachedKernels.end()) &&
+        (it->second.getModeKernel() == kernel)) {
       cachedKernels.erase(it);
     }
   }
@@ -270,6 +440,10 @@ namespace occa {
 
     setModeDevice(occa::newModeDevice(defaults + props));
 
+    if (properties().get("profile", false)) {
+      profiler.enable();
+    }
+
     stream newStream = createStream();
     modeDevice->currentStream = newStream.modeStream;
   }
@@ -278,12 +452,48 @@ namespace occa {
     if (modeDevice == NULL) {
       return;
     }
+
+    // Background builds use the device until they finish
+    modeDevice->kernelMutex.lock();
+    const int buildJobs = modeDevice->buildJobs;
+    modeDevice->kernelMutex.unlock();
+    if (buildJobs) {
+      kernelBuildPool_t::get().removeDeviceJobs(modeDevice);
+    }
+
+    // Release kernels that are still alive (e.g. cached ones) so their
+    //   binaries are unloaded before the device goes away
+    modeDevice->kernelMutex.lock();
+    modeKernel_t *kernelHead = (modeKernel_t*) modeDevice->kernelRing.head;
+    if (kernelHead) {
+      modeKernel_t *ptr = kernelHead;
+      do {
+        ptr->free();
+        ptr = (modeKernel_t*) ptr->rightRingEntry;
+      } while (ptr != kernelHead);
+    }
+    modeDevice->kernelMutex.unlock();
+
+    delete modeDevice->capturingGraph;
+    modeDevice->capturingGraph = NULL;
+
+    // Graphs release their streams while the device is still alive
+    graph_t *graphHead = (graph_t*) modeDevice->graphRing.head;
+    if (graphHead) {
+      graph_t *ptr = graphHead;
+      do {
+        ptr->free();
+        ptr = (graph_t*) ptr->rightRingEntry;
+      } while (ptr != graphHead);
+    }
+
     const int streamCount = modeDevice->streams.size();
 
     for (int i = 0; i < streamCount; ++i) {
       modeDevice->freeStream(modeDevice->streams[i]);
     }
     modeDevice->streams.clear();
+    modeDevice->trimMemoryPool();
     modeDevice->free();
 
     // ~modeDevice_t NULLs all wrappers
@@ -348,23 +558,46 @@ namespace occa {
     return 0;
   }
 
+  udim_t device::maxMemoryAllocated() const {
+    if (modeDevice) {
+      return modeDevice->maxBytesAllocated;
+    }
+    return 0;
+  }
+
+  udim_t device::memoryPooled() const {
+    if (modeDevice) {
+      return modeDevice->bytesPooled;
+    }
+    return 0;
+  }
+
+  void device::trimMemoryPool() {
+    if (modeDevice) {
+      modeDevice->trimMemoryPool();
+    }
+  }
+
+  udim_t device::bytesSyncedToDevice() const {
+    if (modeDevice) {
+      return modeDevice->bytesSyncedToDevice;
+    }
+    return 0;
+  }
+
+  udim_t device::bytesSyncedToHost() const {
+    if (modeDevice) {
+      return modeDevice->bytesSyncedToHost;
+    }
+    return 0;
+  }
+
   void device::finish() {
     if (!modeDevice) {
       return;
     }
     if (modeDevice->hasSeparateMemorySpace()) {
-      const size_t staleEntries = uvaStaleMemory.size();
-      for (size_t i = 0; i < staleEntries; ++i) {
-        occa::modeMemory_t *mem = uvaStaleMemory[i];
-
-        mem->copyTo(mem->uvaPtr, mem->size, 0, "async: true");
-
-        mem->memInfo &= ~uvaFlag::inDevice;
-        mem->memInfo &= ~uvaFlag::isStale;
-      }
-      if (staleEntries) {
-        uvaStaleMemory.clear();
-      }
+      modeDevice->syncStaleMemory();
     }
 
     modeDevice->finish();
@@ -415,6 +648,10 @@ namespace occa {
 
   streamTag device::tagStream() {
     assertInitialized();
+    if (modeDevice->capturingGraph) {
+      modeDevice->capturingGraph->addBarrier();
+      return streamTag(sys::currentTime(), NULL);
+    }
     return modeDevice->tagStream();
   }
 
@@ -429,6 +666,34 @@ namespace occa {
   }
   //  |=================================
 
+  //  |---[ Graph ]---------------------
+  void device::beginCapture(const occa::properties &props) {
+    assertInitialized();
+    OCCA_ERROR("Device is already capturing a graph",
+               modeDevice->capturingGraph == NULL);
+
+    modeDevice->capturingGraph = new graph_t(modeDevice, props);
+  }
+
+  occa::graph device::endCapture() {
+    assertInitialized();
+    OCCA_ERROR("Device is not capturing a graph",
+               modeDevice->capturingGraph != NULL);
+
+    graph_t *modeGraph = modeDevice->capturingGraph;
+    modeDevice->capturingGraph = NULL;
+
+    modeGraph->setupLevels();
+    modeGraph->setupStreams();
+    return occa::graph(modeGraph);
+  }
+
+  bool device::isCapturing() const {
+    return (modeDevice &&
+            modeDevice->capturingGraph);
+  }
+  //  |=================================
+
   //  |---[ Kernel ]--------------------
   kernel device::buildKernel(const std::string &filename,
                              const std::string &kernelName,
@@ -438,26 +703,34 @@ namespace occa {
     occa::properties allProps = props + kernelProperties();
     allProps["mode"] = mode();
 
+    // Kernel properties (e.g. defines) change the generated source
     hash_t kernelHash = (hash()
                          ^ modeDevice->kernelHash(allProps)
+                         ^ occa::hash(allProps)
                          ^ hashFile(filename));
 
-    // TODO: [#185] Fix kernel cache frees
-    // // Check cache first
-    // kernel &cachedKernel = modeDevice->getCachedKernel(kernelHash,
-    //                                                    kernelName);
-    // if (cachedKernel.isInitialized()) {
-    //   return cachedKernel;
-    // }
+    // Check cache first
+    kernel &cachedKernel = modeDevice->getCachedKernel(kernelHash,
+                                                       kernelName);
+    if (cachedKernel.isInitialized()) {
+      return cachedKernel;
+    }
+
+    profileScope_t profile(profileCategory::build,
+                           kernelName);
 
     const std::string realFilename = io::filename(filename);
     const std::string hashDir = io::hashDir(realFilename, kernelHash);
     allProps["hash"] = kernelHash.toFullString();
 
-    kernel cachedKernel = modeDevice->buildKernel(realFilename,
-                                                  kernelName,
-                                                  kernelHash,
-                                                  allProps);
+    // Included files aren't part of the hash
+    io::removeStaleBuild(realFilename, hashDir, kernelHash);
+
+    // The cache keeps a reference until the kernel or device is freed
+    cachedKernel = modeDevice->buildKernel(realFilename,
+                                           kernelName,
+                                           kernelHash,
+                                           allProps);
 
     if (!cachedKernel.isInitialized()) {
       sys::rmrf(hashDir);
@@ -475,8 +748,11 @@ namespace occa {
     allProps["mode"] = mode();
 
     // Store in the same directory as cached outputs
+    // Kernels built from the same string with different properties
+    //   (e.g. okl/fuse) need their own output directory
     hash_t kernelHash = (hash()
                          ^ modeDevice->kernelHash(allProps)
+                         ^ occa::hash(allProps)
                          ^ occa::hash(content));
 
     io::lock_t lock(kernelHash, "occa-device");
@@ -505,45 +781,146 @@ namespace occa {
                                                     props));
   }
 
+  kernelFuture device::buildKernelAsync(const std::string &filename,
+                                        const std::string &kernelName,
+                                        const occa::properties &props) const {
+    assertInitialized();
+
+    kernelBuildJob_t *job = new kernelBuildJob_t(*this,
+                                                 filename,
+                                                 kernelName,
+                                                 props);
+    // Take a reference before the job is shared with the pool
+    kernelFuture future(job);
+
+    modeDevice->kernelMutex.lock();
+    ++(modeDevice->buildJobs);
+    modeDevice->kernelMutex.unlock();
+
+    kernelBuildPool_t::get().push(job);
+    return future;
+  }
+
+  void device::prebuildKernel(const std::string &filename,
+                              const std::string &kernelName,
+                              const occa::properties &props) const {
+    assertInitialized();
+
+    occa::properties allProps = props + kernelProperties();
+    allProps["mode"] = mode();
+
+    // Matches the hash used in buildKernel
+    hash_t kernelHash = (hash()
+                         ^ modeDevice->kernelHash(allProps)
+                         ^ occa::hash(allProps)
+                         ^ hashFile(filename));
+
+    profileScope_t profile(profileCategory::build,
+                           kernelName);
+
+    const std::string realFilename = io::filename(filename);
+    const std::string hashDir = io::hashDir(realFilename, kernelHash);
+    allProps["hash"] = kernelHash.toFullString();
+
+    // Included files aren't part of the hash
+    io::removeStaleBuild(realFilename, hashDir, kernelHash);
+
+    // Kernel handles aren't shared across threads, the binary
+    //   is loaded again by buildKernel on the calling thread
+    modeKernel_t *modeKernel = modeDevice->buildKernel(realFilename,
+                                                       kernelName,
+                                                       kernelHash,
+                                                       allProps);
+    if (!modeKernel) {
+      sys::rmrf(hashDir);
+      return;
+    }
+    modeKernel->free();
+    delete modeKernel;
+  }
+
   void device::loadKernels(const std::string &library) {
-    // TODO 1.1: Load kernels
-#if 0
     assertInitialized();
 
-    std::string devHash = hash().toFullString();
-    strVector dirs = io::directories("occa://" + library);
+    // Library kernels are cached inside the library, not the global cache
+    const std::string cacheDir = (library.size()
+                                  ? (io::libraryPath() + library + "/cache/")
+                                  : io::cachePath());
+    const std::string devHash = modeDevice->versionedHash().toFullString();
+
+    strVector dirs = io::directories(cacheDir);
     const int dirCount = (int) dirs.size();
     int kernelsLoaded = 0;
 
     for (int d = 0; d < dirCount; ++d) {
       const std::string buildFile = dirs[d] + kc::buildFile;
+      const std::string binaryFile = dirs[d] + kc::binaryFile;
+
+      if (!io::isFile(buildFile) ||
+          !io::isFile(binaryFile)) {
+        continue;
+      }
 
-      if (!io::isFile(buildFile)) {
+      // OKL builds with a host launcher (OpenCL, CUDA, HIP) are loaded
+      //   through their launcher by buildKernel, the binary alone only
+      //   holds the device kernels
+      if (io::isFile(dirs[d] + kc::hostBuildFile)) {
         continue;
       }
 
-      json info = json::read(buildFile)["info"];
-      if ((std::string) info["device/hash"] != devHash) {
+      // Leave builds with modified included files to buildKernel
+      if (io::dependenciesChanged(buildFile)) {
         continue;
       }
-      ++kernelsLoaded;
 
-      const std::string sourceFilename = dirs[d] + kc::parsedSourceFile;
+      json info = json::read(buildFile);
+      if (!info.has("device/hash") ||
+          ((std::string) info["device/hash"] != devHash)) {
+        continue;
+      }
 
-      json &kInfo = info["kernel"];
-      hash_t hash = hash_t::fromString(kInfo["hash"]);
-      jsonArray metadataArray = kInfo["metadata"].array();
-      occa::properties kernelProps = kInfo["props"];
+      hash_t kernelHash = hash_t::fromString(info["kernel/hash"]);
+      jsonArray &metadataArray = info["kernel/metadata"].array();
+      occa::properties kernelProps = info["kernel/props"];
 
       // Ignore how the kernel was setup, turn off verbose
       kernelProps["verbose"] = false;
 
-      const int kernels = metadataArray.size();
+      // Reuse the stored metadata instead of reparsing the OKL source
+      std::vector<lang::kernelMetadata> uncachedMetadata;
+      const int kernels = (int) metadataArray.size();
       for (int k = 0; k < kernels; ++k) {
-        buildKernel(sourceFilename,
-                    hash,
-                    kernelProps,
-                    lang::kernelMetadata::fromJson(metadataArray[k]));
+        lang::kernelMetadata metadata = (
+          lang::kernelMetadata::fromJson(metadataArray[k])
+        );
+        if (!modeDevice->getCachedKernel(kernelHash,
+                                         metadata.name).isInitialized()) {
+          uncachedMetadata.push_back(metadata);
+        }
+      }
+      const int uncachedKernels = (int) uncachedMetadata.size();
+      if (!uncachedKernels) {
+        continue;
+      }
+
+      // Launcher-less binaries are shared libraries, once the first
+      //   kernel loads it the others only add a reference
+      for (int k = 0; k < uncachedKernels; ++k) {
+        const lang::kernelMetadata &metadata = uncachedMetadata[k];
+
+        modeKernel_t *modeKernel = (
+          modeDevice->buildKernelFromBinary(binaryFile,
+                                            metadata.name,
+                                            kernelProps)
+        );
+        if (!modeKernel) {
+          continue;
+        }
+        modeKernel->sourceFilename = dirs[d] + kc::sourceFile;
+        modeKernel->metadata = metadata;
+
+        modeDevice->getCachedKernel(kernelHash, metadata.name) = modeKernel;
+        ++kernelsLoaded;
       }
     }
 
@@ -559,7 +936,6 @@ namespace occa {
                     ? " kernel\n"
                     : " kernels\n");
     }
-#endif
   }
   //  |=================================
 
@@ -577,10 +953,36 @@ namespace occa {
                << "negative bytes (" << bytes << ")",
                bytes >= 0);
 
+    profileScope_t profile(profileCategory::malloc,
+                           mode(),
+                           bytes);
+
     occa::properties memProps = props + memoryProperties();
-    memory mem(modeDevice->malloc(bytes, src, memProps));
 
-    modeDevice->bytesAllocated += bytes;
+    // Allocation properties can opt out of a pooled device
+    const bool usePool = props.get("pool",
+                                   memoryProperties().get("pool", false));
+    if (!usePool) {
+      memory mem(modeDevice->malloc(bytes, src, memProps));
+      modeDevice->addBytesAllocated(bytes);
+      return mem;
+    }
+
+    // Reuse a freed block from the same size class if one is available
+    const udim_t blockBytes = modeDevice_t::poolBlockSize(bytes);
+    modeMemory_t *modeMemory = modeDevice->getPooledMemory(blockBytes,
+                                                           memProps);
+    if (!modeMemory) {
+      modeMemory = modeDevice->malloc(blockBytes, NULL, memProps);
+      modeMemory->isPooled = true;
+    }
+    modeMemory->size = bytes;
+
+    memory mem(modeMemory);
+    if (src) {
+      mem.copyFrom(src);
+    }
+    modeDevice->addBytesAllocated(bytes);
 
     return mem;
   }
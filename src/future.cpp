@@ -0,0 +1,341 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <cstdlib>
+
+#include <occa/future.hpp>
+#include <occa/tools/env.hpp>
+
+namespace occa {
+  //---[ kernelBuildJob_t ]-------------
+  kernelBuildJob_t::kernelBuildJob_t(const occa::device &device_,
+                                     const std::string &filename_,
+                                     const std::string &kernelName_,
+                                     const occa::properties &props_) :
+    device(device_),
+    filename(filename_),
+    kernelName(kernelName_),
+    props(props_),
+    settings(occa::settings()),
+    done(false),
+    error(NULL),
+    refs(0) {}
+
+  kernelBuildJob_t::~kernelBuildJob_t() {
+    delete error;
+    doneCondition.free();
+  }
+
+  void kernelBuildJob_t::run() {
+    occa::settings() = settings;
+
+    // Errors are rethrown on the calling thread by kernelFuture::get
+    try {
+      device.prebuildKernel(filename,
+                            kernelName,
+                            props);
+    } catch (exception &exc) {
+      error = new exception(exc);
+    }
+  }
+
+  void kernelBuildJob_t::cancel() {
+    error = new exception("Error",
+                          __FILE__,
+                          __FUNCTION__,
+                          __LINE__,
+                          "Device was freed before building kernel ["
+                          + kernelName + "]");
+    releaseDevice();
+    finish();
+  }
+
+  void kernelBuildJob_t::releaseDevice() {
+    modeDevice_t *modeDevice = device.getModeDevice();
+    if (modeDevice) {
+      modeDevice->kernelMutex.lock();
+      --(modeDevice->buildJobs);
+      modeDevice->kernelMutex.unlock();
+    }
+  }
+
+  void kernelBuildJob_t::finish() {
+    doneCondition.lock();
+    done = true;
+    doneCondition.broadcast();
+    doneCondition.unlock();
+  }
+
+  bool kernelBuildJob_t::isDone() {
+    doneCondition.lock();
+    const bool isDone_ = done;
+    doneCondition.unlock();
+    return isDone_;
+  }
+
+  void kernelBuildJob_t::wait() {
+    doneCondition.lock();
+    while (!done) {
+      doneCondition.wait();
+    }
+    doneCondition.unlock();
+  }
+  //====================================
+
+  //---[ kernelBuildPool_t ]------------
+  kernelBuildPool_t::kernelBuildPool_t() :
+    stopping(false) {}
+
+  kernelBuildPool_t::~kernelBuildPool_t() {
+    stop();
+    jobCondition.free();
+  }
+
+  kernelBuildPool_t& kernelBuildPool_t::get() {
+    static kernelBuildPool_t pool;
+    if (!pool.size()) {
+      pool.start(defaultSize());
+    }
+    return pool;
+  }
+
+  int kernelBuildPool_t::defaultSize() {
+    const std::string threadCount = env::var("OCCA_BUILD_THREADS");
+    if (threadCount.size()) {
+      const int count = ::atoi(threadCount.c_str());
+      if (count > 0) {
+        return count;
+      }
+    }
+    const int coreCount = sys::getCoreCount();
+    return (coreCount > 0) ? coreCount : 1;
+  }
+
+  int kernelBuildPool_t::size() const {
+    return (int) threads.size();
+  }
+
+  void kernelBuildPool_t::start(const int threadCount) {
+    stop();
+
+    threads.resize(threadCount);
+    for (int t = 0; t < threadCount; ++t) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_create(&(threads[t]), NULL, kernelBuildLoop, this);
+#else
+      threads[t] = CreateThread(NULL, 0,
+                                (LPTHREAD_START_ROUTINE) kernelBuildLoop,
+                                this, 0, NULL);
+#endif
+    }
+  }
+
+  void kernelBuildPool_t::stop() {
+    if (threads.empty()) {
+      return;
+    }
+
+    // Queued jobs still run before the workers exit
+    jobCondition.lock();
+    stopping = true;
+    jobCondition.broadcast();
+    jobCondition.unlock();
+
+    const int threadCount = (int) threads.size();
+    for (int t = 0; t < threadCount; ++t) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_join(threads[t], NULL);
+#else
+      WaitForSingleObject(threads[t], INFINITE);
+      CloseHandle(threads[t]);
+#endif
+    }
+    threads.clear();
+    stopping = false;
+  }
+
+  void kernelBuildPool_t::push(kernelBuildJob_t *job) {
+    jobCondition.lock();
+    jobs.push_back(job);
+    jobCondition.signal();
+    jobCondition.unlock();
+  }
+
+  kernelBuildJob_t* kernelBuildPool_t::pop() {
+    jobCondition.lock();
+    while (jobs.empty() && !stopping) {
+      jobCondition.wait();
+    }
+    kernelBuildJob_t *job = NULL;
+    if (!jobs.empty()) {
+      job = jobs.front();
+      jobs.pop_front();
+      runningJobs.push_back(job);
+    }
+    jobCondition.unlock();
+    return job;
+  }
+
+  void kernelBuildPool_t::finishJob(kernelBuildJob_t *job) {
+    // The device can be freed once the job stops running and the job
+    //   can be deleted once it's done
+    job->releaseDevice();
+
+    jobCondition.lock();
+    const int jobCount = (int) runningJobs.size();
+    for (int i = 0; i < jobCount; ++i) {
+      if (runningJobs[i] == job) {
+        runningJobs.erase(runningJobs.begin() + i);
+        break;
+      }
+    }
+    jobCondition.broadcast();
+    jobCondition.unlock();
+
+    job->finish();
+  }
+
+  void kernelBuildPool_t::removeDeviceJobs(modeDevice_t *modeDevice) {
+    std::vector<kernelBuildJob_t*> cancelledJobs;
+
+    jobCondition.lock();
+    std::deque<kernelBuildJob_t*>::iterator it = jobs.begin();
+    while (it != jobs.end()) {
+      if ((*it)->device.getModeDevice() == modeDevice) {
+        cancelledJobs.push_back(*it);
+        it = jobs.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    while (true) {
+      bool isRunning = false;
+      const int jobCount = (int) runningJobs.size();
+      for (int i = 0; i < jobCount; ++i) {
+        if (runningJobs[i]->device.getModeDevice() == modeDevice) {
+          isRunning = true;
+          break;
+        }
+      }
+      if (!isRunning) {
+        break;
+      }
+      jobCondition.wait();
+    }
+    jobCondition.unlock();
+
+    const int cancelledCount = (int) cancelledJobs.size();
+    for (int i = 0; i < cancelledCount; ++i) {
+      cancelledJobs[i]->cancel();
+    }
+  }
+
+  void* kernelBuildLoop(void *args) {
+    kernelBuildPool_t &pool = *((kernelBuildPool_t*) args);
+    while (true) {
+      kernelBuildJob_t *job = pool.pop();
+      if (!job) {
+        break;
+      }
+      job->run();
+      pool.finishJob(job);
+    }
+    return NULL;
+  }
+  //====================================
+
+  //---[ kernelFuture ]-----------------
+  kernelFuture::kernelFuture() :
+    job(NULL) {}
+
+  kernelFuture::kernelFuture(kernelBuildJob_t *job_) :
+    job(NULL) {
+    setJob(job_);
+  }
+
+  kernelFuture::kernelFuture(const kernelFuture &other) :
+    job(NULL) {
+    setJob(other.job);
+  }
+
+  kernelFuture& kernelFuture::operator = (const kernelFuture &other) {
+    setJob(other.job);
+    return *this;
+  }
+
+  kernelFuture::~kernelFuture() {
+    removeRef();
+  }
+
+  void kernelFuture::setJob(kernelBuildJob_t *job_) {
+    if (job == job_) {
+      return;
+    }
+    removeRef();
+    job = job_;
+    if (job) {
+      ++(job->refs);
+    }
+  }
+
+  void kernelFuture::removeRef() {
+    if (!job) {
+      return;
+    }
+    if (--(job->refs) == 0) {
+      // The worker still uses the job until the build is done
+      job->wait();
+      delete job;
+    }
+    job = NULL;
+  }
+
+  bool kernelFuture::isInitialized() const {
+    return (job != NULL);
+  }
+
+  bool kernelFuture::isReady() const {
+    return (job && job->isDone());
+  }
+
+  void kernelFuture::wait() const {
+    if (job) {
+      job->wait();
+    }
+  }
+
+  occa::kernel kernelFuture::get() const {
+    OCCA_ERROR("Kernel future not initialized",
+               job != NULL);
+    job->wait();
+    if (job->error) {
+      throw *(job->error);
+    }
+    if (!job->builtKernel.isInitialized()) {
+      job->builtKernel = job->device.buildKernel(job->filename,
+                                                 job->kernelName,
+                                                 job->props);
+    }
+    return job->builtKernel;
+  }
+  //====================================
+}
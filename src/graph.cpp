@@ -0,0 +1,420 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/graph.hpp>
+#include <occa/device.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  //---[ Graph Nodes ]------------------
+  graphAccess_t::graphAccess_t(const void *ptr,
+                               const udim_t bytes,
+                               const bool isWrite_) :
+    start((const char*) ptr),
+    end(((const char*) ptr) + bytes),
+    isWrite(isWrite_) {}
+
+  bool graphAccess_t::conflictsWith(const graphAccess_t &other) const {
+    return ((isWrite || other.isWrite)
+            && (start < other.end)
+            && (other.start < end));
+  }
+
+  graphNode_t::graphNode_t() :
+    level(0) {}
+
+  graphNode_t::~graphNode_t() {}
+
+  void graphNode_t::addAccess(const void *ptr,
+                              const udim_t bytes,
+                              const bool isWrite) {
+    accesses.push_back(graphAccess_t(ptr, bytes, isWrite));
+  }
+
+  bool graphNode_t::dependsOn(const graphNode_t &other) const {
+    if (isBarrier() || other.isBarrier()) {
+      return true;
+    }
+    const int accessCount = (int) accesses.size();
+    const int otherAccessCount = (int) other.accesses.size();
+    for (int i = 0; i < accessCount; ++i) {
+      for (int j = 0; j < otherAccessCount; ++j) {
+        if (accesses[i].conflictsWith(other.accesses[j])) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  bool graphNode_t::isBarrier() const {
+    return false;
+  }
+
+  graphLaunchNode_t::graphLaunchNode_t(const occa::kernel &kernel_) :
+    launchedKernel(kernel_) {
+
+    modeKernel_t *modeKernel = launchedKernel.getModeKernel();
+    arguments = modeKernel->arguments;
+
+    // Non-const memory arguments are treated as written to
+    const int argc = (int) arguments.size();
+    for (int i = 0; i < argc; ++i) {
+      const bool isConst = modeKernel->metadata.argIsConst(i);
+      argIsConst.push_back(isConst);
+
+      const kArgVector &iArgs = arguments[i].args;
+      const int iArgCount = (int) iArgs.size();
+      for (int ai = 0; ai < iArgCount; ++ai) {
+        modeMemory_t *modeMemory = iArgs[ai].modeMemory;
+        if (modeMemory) {
+          addAccess(modeMemory->ptr, modeMemory->size, !isConst);
+        }
+      }
+    }
+  }
+
+  void graphLaunchNode_t::run(const bool async) {
+    modeKernel_t *modeKernel = launchedKernel.getModeKernel();
+
+    // Arguments were checked when captured
+    modeKernel->arguments.swap(arguments);
+    const int argc = (int) modeKernel->arguments.size();
+    for (int i = 0; i < argc; ++i) {
+      modeKernel->arguments[i].setupForKernelCall(argIsConst[i]);
+    }
+    modeKernel->run();
+    modeKernel->arguments.swap(arguments);
+  }
+
+  graphCopyNode_t::graphCopyNode_t(occa::memory dest_,
+                                   void *destPtr_,
+                                   const udim_t destOffset_,
+                                   occa::memory src_,
+                                   const void *srcPtr_,
+                                   const udim_t srcOffset_,
+                                   const udim_t bytes_,
+                                   const occa::properties &props_) :
+    dest(dest_),
+    src(src_),
+    destPtr(destPtr_),
+    srcPtr(srcPtr_),
+    bytes(bytes_),
+    destOffset(destOffset_),
+    srcOffset(srcOffset_),
+    props(props_) {
+
+    asyncProps = props;
+    asyncProps["async"] = true;
+
+    if (dest.isInitialized()) {
+      addAccess(dest.getModeMemory()->ptr + destOffset, bytes, true);
+    } else {
+      addAccess(destPtr, bytes, true);
+    }
+    if (src.isInitialized()) {
+      addAccess(src.getModeMemory()->ptr + srcOffset, bytes, false);
+    } else {
+      addAccess(srcPtr, bytes, false);
+    }
+  }
+
+  void graphCopyNode_t::run(const bool async) {
+    const occa::properties &runProps = async ? asyncProps : props;
+    modeMemory_t *destMemory = dest.getModeMemory();
+    modeMemory_t *srcMemory  = src.getModeMemory();
+
+    // Bounds were checked when captured
+    if (destMemory && srcMemory) {
+      destMemory->copyFrom(srcMemory, bytes, destOffset, srcOffset, runProps);
+    } else if (destMemory) {
+      destMemory->copyFrom(srcPtr, bytes, destOffset, runProps);
+    } else {
+      srcMemory->copyTo(destPtr, bytes, srcOffset, runProps);
+    }
+  }
+
+  bool graphBarrierNode_t::isBarrier() const {
+    return true;
+  }
+
+  void graphBarrierNode_t::run(const bool async) {}
+  //====================================
+
+  //---[ graph_t ]----------------------
+  graph_t::graph_t(modeDevice_t *modeDevice_,
+                   const occa::properties &properties_) :
+    modeDevice(modeDevice_),
+    properties(properties_) {
+    modeDevice->addGraphRef(this);
+  }
+
+  graph_t::~graph_t() {
+    free();
+
+    // NULL all wrappers
+    graph *head = (graph*) graphRing.head;
+    if (head) {
+      // Unlink entries after the head until it's the only one left
+      while (!head->isAlone()) {
+        graph *ptr = (graph*) head->rightRingEntry;
+        ptr->modeGraph = NULL;
+        ptr->removeRef();
+      }
+      head->modeGraph = NULL;
+    }
+    // Remove ref from device
+    if (modeDevice) {
+      modeDevice->removeGraphRef(this);
+    }
+  }
+
+  void graph_t::dontUseRefs() {
+    graphRing.dontUseRefs();
+  }
+
+  void graph_t::addGraphRef(graph *graph_) {
+    graphRing.addRef(graph_);
+  }
+
+  void graph_t::removeGraphRef(graph *graph_) {
+    graphRing.removeRef(graph_);
+  }
+
+  bool graph_t::needsFree() const {
+    return graphRing.needsFree();
+  }
+
+  void graph_t::free() {
+    const int nodeCount = (int) nodes.size();
+    for (int i = 0; i < nodeCount; ++i) {
+      delete nodes[i];
+    }
+    nodes.clear();
+    levels.clear();
+
+    // Streams are freed with the device if it goes first
+    if (!modeDevice) {
+      streams.clear();
+      return;
+    }
+
+    const int streamCount = (int) streams.size();
+    for (int i = 0; i < streamCount; ++i) {
+      std::vector<stream_t> &deviceStreams = modeDevice->streams;
+      const int deviceStreamCount = (int) deviceStreams.size();
+      for (int j = 0; j < deviceStreamCount; ++j) {
+        if (deviceStreams[j] == streams[i]) {
+          deviceStreams.erase(deviceStreams.begin() + j);
+          break;
+        }
+      }
+      modeDevice->freeStream(streams[i]);
+    }
+    streams.clear();
+  }
+
+  void graph_t::addLaunch(const occa::kernel &kernel) {
+    addNode(new graphLaunchNode_t(kernel));
+  }
+
+  void graph_t::addCopy(occa::memory dest,
+                        void *destPtr,
+                        const udim_t destOffset,
+                        occa::memory src,
+                        const void *srcPtr,
+                        const udim_t srcOffset,
+                        const udim_t bytes,
+                        const occa::properties &props) {
+    addNode(new graphCopyNode_t(dest, destPtr, destOffset,
+                                src, srcPtr, srcOffset,
+                                bytes, props));
+  }
+
+  void graph_t::addBarrier() {
+    addNode(new graphBarrierNode_t());
+  }
+
+  void graph_t::addNode(graphNode_t *node) {
+    nodes.push_back(node);
+  }
+
+  void graph_t::setupLevels() {
+    levels.clear();
+
+    // Each node runs one level after the last node it depends on
+    const int nodeCount = (int) nodes.size();
+    for (int i = 0; i < nodeCount; ++i) {
+      graphNode_t &node = *(nodes[i]);
+      node.level = 0;
+      for (int j = 0; j < i; ++j) {
+        const graphNode_t &prevNode = *(nodes[j]);
+        if ((node.level <= prevNode.level)
+            && node.dependsOn(prevNode)) {
+          node.level = prevNode.level + 1;
+        }
+      }
+      if ((int) levels.size() <= node.level) {
+        levels.resize(node.level + 1);
+      }
+      levels[node.level].push_back(&node);
+    }
+  }
+
+  void graph_t::setupStreams() {
+    // Host modes can run independent kernels side by side
+    const bool isHostMode = ((modeDevice->mode == "Serial") ||
+                             (modeDevice->mode == "OpenMP"));
+    if (!properties.get("concurrent", isHostMode)) {
+      return;
+    }
+
+    int maxLevelSize = 0;
+    const int levelCount = (int) levels.size();
+    for (int i = 0; i < levelCount; ++i) {
+      maxLevelSize = std::max(maxLevelSize,
+                              (int) levels[i].size());
+    }
+
+    const int streamCount = std::min(maxLevelSize,
+                                     properties.get("streams", 4));
+    if (streamCount < 2) {
+      return;
+    }
+    for (int i = 0; i < streamCount; ++i) {
+      stream_t modeStream = modeDevice->createStream();
+      modeDevice->streams.push_back(modeStream);
+      streams.push_back(modeStream);
+    }
+  }
+
+  void graph_t::run() {
+    stream_t currentStream = modeDevice->currentStream;
+    const int streamCount = (int) streams.size();
+
+    const int levelCount = (int) levels.size();
+    for (int i = 0; i < levelCount; ++i) {
+      std::vector<graphNode_t*> &levelNodes = levels[i];
+      const int nodeCount = (int) levelNodes.size();
+
+      if ((nodeCount == 1) || !streamCount) {
+        for (int n = 0; n < nodeCount; ++n) {
+          levelNodes[n]->run(false);
+        }
+        continue;
+      }
+
+      // Earlier levels need to finish before other streams start
+      modeDevice->finish();
+      for (int n = 0; n < nodeCount; ++n) {
+        modeDevice->currentStream = streams[n % streamCount];
+        levelNodes[n]->run(true);
+      }
+      modeDevice->currentStream = currentStream;
+      modeDevice->finish();
+    }
+  }
+  //====================================
+
+  //---[ graph ]------------------------
+  graph::graph() :
+    modeGraph(NULL) {}
+
+  graph::graph(graph_t *modeGraph_) :
+    modeGraph(NULL) {
+    setModeGraph(modeGraph_);
+  }
+
+  graph::graph(const graph &g) :
+    modeGraph(NULL) {
+    setModeGraph(g.modeGraph);
+  }
+
+  graph& graph::operator = (const graph &g) {
+    setModeGraph(g.modeGraph);
+    return *this;
+  }
+
+  graph::~graph() {
+    removeGraphRef();
+  }
+
+  void graph::setModeGraph(graph_t *modeGraph_) {
+    if (modeGraph != modeGraph_) {
+      removeGraphRef();
+      modeGraph = modeGraph_;
+      if (modeGraph) {
+        modeGraph->addGraphRef(this);
+      }
+    }
+  }
+
+  void graph::removeGraphRef() {
+    if (!modeGraph) {
+      return;
+    }
+    modeGraph->removeGraphRef(this);
+    if (modeGraph->needsFree()) {
+      free();
+    }
+  }
+
+  void graph::dontUseRefs() {
+    if (modeGraph) {
+      modeGraph->dontUseRefs();
+    }
+  }
+
+  bool graph::isInitialized() const {
+    return (modeGraph != NULL);
+  }
+
+  graph_t* graph::getModeGraph() const {
+    return modeGraph;
+  }
+
+  int graph::size() const {
+    return (modeGraph
+            ? (int) modeGraph->nodes.size()
+            : 0);
+  }
+
+  int graph::levels() const {
+    return (modeGraph
+            ? (int) modeGraph->levels.size()
+            : 0);
+  }
+
+  void graph::run() {
+    OCCA_ERROR("Graph not initialized or has been freed",
+               modeGraph != NULL);
+    modeGraph->run();
+  }
+
+  void graph::free() {
+    if (modeGraph == NULL) {
+      return;
+    }
+    // ~graph_t NULLs all wrappers
+    delete modeGraph;
+  }
+  //====================================
+}
@@ -28,6 +28,7 @@
 #include <occa/tools/env.hpp>
 #include <occa/tools/lex.hpp>
 #include <occa/tools/properties.hpp>
+#include <occa/tools/sys.hpp>
 
 namespace occa {
   namespace io {
@@ -160,5 +161,84 @@ namespace occa {
         info.write(filename);
       }
     }
+
+    void setDependencyProps(occa::json &props,
+                            const strVector &filenames) {
+      json &dependencies = props.asArray();
+      const int fileCount = (int) filenames.size();
+      for (int i = 0; i < fileCount; ++i) {
+        const fileStamp_t stamp = fileStamp(filenames[i]);
+
+        json dependency;
+        dependency["file"]             = io::filename(filenames[i]);
+        dependency["bytes"]            = (uint64_t) stamp.bytes;
+        dependency["modified_time"]    = stamp.modifiedTime;
+        dependency["modified_time_ns"] = stamp.modifiedTimeNs;
+        dependency["hash"]             = stamp.hash.toFullString();
+        dependencies += dependency;
+      }
+    }
+
+    bool dependenciesChanged(const std::string &buildFile) {
+      // Kernels without a build file (e.g. okl: false) have no manifest
+      if (!io::isFile(buildFile)) {
+        return false;
+      }
+
+      json info = json::read(buildFile);
+      if (!info.has("dependencies")) {
+        return false;
+      }
+
+      const jsonArray &dependencies = info["dependencies"].array();
+      const int fileCount = (int) dependencies.size();
+      for (int i = 0; i < fileCount; ++i) {
+        const json &dependency = dependencies[i];
+        const std::string filename = dependency["file"];
+
+        fileStamp_t cachedStamp;
+        cachedStamp.bytes          = (uint64_t) dependency["bytes"];
+        cachedStamp.modifiedTime   = (int64_t) dependency["modified_time"];
+        cachedStamp.modifiedTimeNs = (int64_t) dependency["modified_time_ns"];
+
+        fileStamp_t stamp;
+        if (!stamp.load(filename)) {
+          return true;
+        }
+        // Only hash files that were touched since the build
+        if (!stamp.sameModification(cachedStamp)
+            && (occa::hashFile(filename).toFullString()
+                != (std::string) dependency["hash"])) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void removeStaleBuild(const std::string &filename,
+                          const std::string &hashDir,
+                          const hash_t &hash) {
+      const std::string buildFile = hashDir + kc::buildFile;
+      if (!dependenciesChanged(buildFile)) {
+        return;
+      }
+      // Check again in case another process already rebuilt it
+      io::lock_t lock(hash, "kernel-dependencies");
+      if (!lock.isMine() ||
+          !dependenciesChanged(buildFile)) {
+        return;
+      }
+      // Kernels built from strings keep their source in the hash directory
+      strVector outputs = io::files(hashDir);
+      const strVector dirs = io::directories(hashDir);
+      outputs.insert(outputs.end(), dirs.begin(), dirs.end());
+
+      const int outputCount = (int) outputs.size();
+      for (int i = 0; i < outputCount; ++i) {
+        if (outputs[i] != filename) {
+          sys::rmrf(outputs[i]);
+        }
+      }
+    }
   }
 }
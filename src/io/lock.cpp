@@ -20,12 +20,20 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 #include <cmath>
-#include <errno.h>
+#include <fcntl.h>
+#include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <sys/types.h>
 #include <unistd.h>
 
 #include <occa/defines.hpp>
+
+#if (OCCA_OS == OCCA_LINUX_OS)
+#  include <poll.h>
+#  include <sys/inotify.h>
+#endif
+
 #include <occa/io/lock.hpp>
 #include <occa/io/utils.hpp>
 #include <occa/tools/env.hpp>
@@ -33,21 +41,23 @@
 namespace occa {
   namespace io {
     lock_t::lock_t() :
+      fd(-1),
       isMineCached(false),
       released(true) {}
 
     lock_t::lock_t(const hash_t &hash,
                    const std::string &tag,
                    const float staleAge_) :
+      fd(-1),
       isMineCached(false),
       staleAge(staleAge_),
       released(false) {
 
-      lockDir = env::OCCA_CACHE_DIR;
-      lockDir += "locks/";
-      lockDir += hash.toString();
-      lockDir += '_';
-      lockDir += tag;
+      lockFile = env::OCCA_CACHE_DIR;
+      lockFile += "locks/";
+      lockFile += hash.toString();
+      lockFile += '_';
+      lockFile += tag;
 
       occa::json &lockSettings = settings()["locks"];
       staleWarning = lockSettings.get("stale-warning",
@@ -63,18 +73,69 @@ namespace occa {
     }
 
     bool lock_t::isInitialized() const {
-      return lockDir.size();
+      return lockFile.size();
     }
 
-    const std::string& lock_t::dir() const {
-      return lockDir;
+    const std::string& lock_t::file() const {
+      return lockFile;
     }
 
     void lock_t::release() const {
-      if (!released) {
-        sys::rmdir(lockDir);
-        released = true;
+      if (released) {
+        return;
+      }
+      if (fd >= 0) {
+        // Only remove the file if a stale-lock cleanup didn't replace it
+        struct stat fdInfo, fileInfo;
+        if (!::fstat(fd, &fdInfo)
+            && !::stat(lockFile.c_str(), &fileInfo)
+            && (fdInfo.st_ino == fileInfo.st_ino)
+            && (fdInfo.st_dev == fileInfo.st_dev)) {
+          ::unlink(lockFile.c_str());
+        }
+        // Unlinking before unlocking lets waiters see the release
+        ::flock(fd, LOCK_UN);
+        ::close(fd);
+        fd = -1;
+      }
+      released = true;
+    }
+
+    bool lock_t::tryLock() {
+      while (true) {
+        fd = ::open(lockFile.c_str(), O_RDWR | O_CREAT, 0666);
+        if (fd < 0) {
+          // Locks are unavailable, continue without one
+          return true;
+        }
+
+        if (::flock(fd, LOCK_EX | LOCK_NB)) {
+          ::close(fd);
+          fd = -1;
+          return false;
+        }
+
+        // The previous owner could have removed the file before we locked it
+        struct stat fdInfo, fileInfo;
+        if (!::fstat(fd, &fdInfo)
+            && !::stat(lockFile.c_str(), &fileInfo)
+            && (fdInfo.st_ino == fileInfo.st_ino)
+            && (fdInfo.st_dev == fileInfo.st_dev)) {
+          break;
+        }
+        ::flock(fd, LOCK_UN);
+        ::close(fd);
+        fd = -1;
+      }
+
+      // Store the owner, also updating the time used for stale checks
+      const std::string pid = toString(::getpid()) + '\n';
+      if (::ftruncate(fd, 0) ||
+          (::write(fd, pid.c_str(), pid.size()) < 0)) {
+        ::futimes(fd, NULL);
       }
+      released = false;
+      return true;
     }
 
     bool lock_t::isMine() {
@@ -84,14 +145,10 @@ namespace occa {
       sys::mkpath(env::OCCA_CACHE_DIR + "locks/");
 
       while (true) {
-        int mkdirStatus = sys::mkdir(lockDir);
-
-        if (!mkdirStatus
-            || (errno != EEXIST)) {
+        if (tryLock()) {
           isMineCached = true;
           return true;
         }
-
         if (isReleased()) {
           break;
         }
@@ -100,39 +157,84 @@ namespace occa {
     }
 
     bool lock_t::isReleased() {
-      const char *c_lockDir = lockDir.c_str();
+      const char *c_lockFile = lockFile.c_str();
       double startTime = sys::currentTime();
-      bool isStale = false;
 
-      struct stat buffer;
-      while(!stat(c_lockDir, &buffer)) {
+      // Keep the file open to check if its owner still holds the lock
+      const int probeFd = ::open(c_lockFile, O_RDONLY);
+      if (probeFd < 0) {
+        return true;
+      }
+      struct stat probeInfo;
+      ::fstat(probeFd, &probeInfo);
+
+#if (OCCA_OS == OCCA_LINUX_OS)
+      // Wake up as soon as the owner removes or closes the lock file
+      int notifyFd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+      if ((notifyFd >= 0) &&
+          (::inotify_add_watch(notifyFd, c_lockFile,
+                               IN_ATTRIB | IN_DELETE_SELF | IN_CLOSE_WRITE) < 0)) {
+        ::close(notifyFd);
+        notifyFd = -1;
+      }
+#endif
+
+      bool isReleased_ = false;
+      while (true) {
+        struct stat fileInfo;
+        if (::stat(c_lockFile, &fileInfo)
+            || (fileInfo.st_ino != probeInfo.st_ino)
+            || (fileInfo.st_dev != probeInfo.st_dev)) {
+          // Other process released the lock
+          isReleased_ = true;
+          break;
+        }
+
+        // The owner exited without releasing the lock
+        if (!::flock(probeFd, LOCK_SH | LOCK_NB)) {
+          ::flock(probeFd, LOCK_UN);
+          break;
+        }
+
         const double age = ::difftime(::time(NULL),
-                                      buffer.st_ctime);
+                                      fileInfo.st_mtime);
         if (std::abs(age) >= staleAge) {
-          isStale = true;
+          // Delete the stale lock so it can be recreated
+          ::unlink(c_lockFile);
           break;
         }
         // Print warning only once
         if ((sys::currentTime() - startTime) > staleWarning) {
           std::cerr << "Located possible stale hash: ["
-                    << lockDir
+                    << lockFile
                     << "]\n";
           staleWarning = staleAge + 10;
         }
 
-        // Wait 0.5 seconds before trying again
-        ::usleep(500000);
+        // Fall back on polling for filesystems without notifications
+#if (OCCA_OS == OCCA_LINUX_OS)
+        if (notifyFd >= 0) {
+          struct pollfd pfd;
+          pfd.fd = notifyFd;
+          pfd.events = POLLIN;
+          if (::poll(&pfd, 1, 100) > 0) {
+            char events[4096];
+            while (::read(notifyFd, events, sizeof(events)) > 0) {}
+          }
+          continue;
+        }
+#endif
+        ::usleep(10000);
       }
 
-      // Other process released the hash
-      if (!isStale) {
-        return true;
+#if (OCCA_OS == OCCA_LINUX_OS)
+      if (notifyFd >= 0) {
+        ::close(notifyFd);
       }
-      // Delete lock and recreate it
-      release();
-      released = false;
+#endif
+      ::close(probeFd);
 
-      return false;
+      return isReleased_;
     }
   }
 }
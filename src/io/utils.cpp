@@ -52,6 +52,8 @@ namespace occa {
     const std::string hostSourceFile = "host_source.cpp";
     const std::string hostBinaryFile = "host_binary";
     const std::string hostBuildFile  = "host_build.json";
+    const std::string tuneFile       = "tune.json";
+    const std::string buildLogFile   = "build.log";
   }
 
   namespace io {
@@ -20,15 +20,21 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 
+#include <cstring>
+
 #include <occa/kernel.hpp>
 #include <occa/device.hpp>
+#include <occa/graph.hpp>
 #include <occa/memory.hpp>
 #include <occa/uva.hpp>
 #include <occa/io.hpp>
+#include <occa/tools/lex.hpp>
+#include <occa/tools/profiler.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/lang/parser.hpp>
 #include <occa/lang/builtins/types.hpp>
 #include <occa/lang/builtins/transforms/finders.hpp>
+#include <occa/lang/builtins/transforms/fuse.hpp>
 
 namespace occa {
   //---[ modeKernel_t ]---------------------
@@ -47,13 +53,13 @@ namespace occa {
     // NULL all wrappers
     kernel *head = (kernel*) kernelRing.head;
     if (head) {
-      kernel *ptr = head;
-      do {
-        kernel *nextPtr = (kernel*) ptr->rightRingEntry;
+      // Unlink entries after the head until it's the only one left
+      while (!head->isAlone()) {
+        kernel *ptr = (kernel*) head->rightRingEntry;
         ptr->modeKernel = NULL;
         ptr->removeRef();
-        ptr = nextPtr;
-      } while (ptr != head);
+      }
+      head->modeKernel = NULL;
     }
     // Remove ref from device
     if (modeDevice) {
@@ -202,6 +208,37 @@ namespace occa {
             : noBinaryFilename);
   }
 
+  occa::kernel kernel::specialize(const std::string &argName,
+                                  const primitive &value) {
+    occa::properties values;
+    values[argName] = value;
+    return specialize(values);
+  }
+
+  occa::kernel kernel::specialize(const occa::properties &values) {
+    assertInitialized();
+
+    // Specialized arguments are part of the kernel properties,
+    //   so the new build gets its own hash
+    occa::properties props = modeKernel->properties;
+    props.remove("hash");
+    props.remove("build");
+    props["okl/specialize"] += values;
+
+    // Cached sources (e.g. from buildKernelFromString) share their
+    //   output directory, rebuild them from their content instead
+    occa::device device = getDevice();
+    const std::string &filename = modeKernel->sourceFilename;
+    if (startsWith(filename, io::cachePath())) {
+      return device.buildKernelFromString(io::read(filename),
+                                          modeKernel->name,
+                                          props);
+    }
+    return device.buildKernel(filename,
+                              modeKernel->name,
+                              props);
+  }
+
   void kernel::setRunDims(occa::dim outerDims, occa::dim innerDims) {
     if (modeKernel) {
       modeKernel->innerDims = innerDims;
@@ -241,9 +278,30 @@ namespace occa {
     modeKernel->arguments[argPos] = arg;
   }
 
+  void kernel::setArguments(const kernelArg **args,
+                            const int argc) const {
+    assertInitialized();
+
+    // Reuse the existing argument storage
+    std::vector<kernelArg> &arguments = modeKernel->arguments;
+    arguments.resize(argc);
+    for (int i = 0; i < argc; ++i) {
+      arguments[i] = *(args[i]);
+    }
+  }
+
   void kernel::run() const {
     assertInitialized();
 
+    graph_t *capturingGraph = modeKernel->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addLaunch(*this);
+      return;
+    }
+
+    profileScope_t profile(profileCategory::kernel,
+                           modeKernel->name);
+
     const int argc = (int) modeKernel->arguments.size();
     for (int i = 0; i < argc; ++i) {
       const bool argIsConst = modeKernel->metadata.argIsConst(i);
@@ -266,9 +324,128 @@ namespace occa {
       return;
     }
 
-    modeKernel->free();
+    modeKernel_t *modeKernel_ = modeKernel;
+    // The caller still holds a reference, dropping the cached one
+    //   won't trigger another free
+    if (modeKernel_->modeDevice) {
+      modeKernel_->modeDevice->removeCachedKernel(modeKernel_);
+    }
+
+    modeKernel_->free();
     // ~modeKernel_t NULLs all wrappers
-    delete modeKernel;
+    delete modeKernel_;
+  }
+  //====================================
+
+  //---[ kernelFrame ]------------------
+  kernelFrame::kernelFrame() {}
+
+  kernelFrame::kernelFrame(const occa::kernel &kernel_) :
+    launchedKernel(kernel_) {}
+
+  kernelFrame::kernelFrame(const kernelFrame &other) :
+    launchedKernel(other.launchedKernel),
+    arguments(other.arguments) {
+    copyValues();
+  }
+
+  kernelFrame& kernelFrame::operator = (const kernelFrame &other) {
+    if (this != &other) {
+      launchedKernel = other.launchedKernel;
+      arguments = other.arguments;
+      copyValues();
+    }
+    return *this;
+  }
+
+  void kernelFrame::copyValues() {
+    // Values are padded to keep each copy aligned
+    const size_t alignment = sizeof(double);
+
+    size_t valueBytes = 0;
+    const int argc = (int) arguments.size();
+    for (int i = 0; i < argc; ++i) {
+      kArgVector &args = arguments[i].args;
+      const int argCount = args.size();
+      for (int j = 0; j < argCount; ++j) {
+        if (args[j].info & kArgInfo::isValue) {
+          valueBytes += ((args[j].size + alignment - 1) / alignment) * alignment;
+        }
+      }
+    }
+    if (!valueBytes) {
+      values.clear();
+      return;
+    }
+
+    // Arguments may point into the current buffer
+    std::vector<char> newValues(valueBytes);
+    char *value = &(newValues[0]);
+    for (int i = 0; i < argc; ++i) {
+      kArgVector &args = arguments[i].args;
+      const int argCount = args.size();
+      for (int j = 0; j < argCount; ++j) {
+        kernelArgData &arg = args[j];
+        if (arg.info & kArgInfo::isValue) {
+          ::memcpy(value, arg.data.void_, arg.size);
+          arg.data.void_ = value;
+          value += ((arg.size + alignment - 1) / alignment) * alignment;
+        }
+      }
+    }
+    values.swap(newValues);
+  }
+
+  bool kernelFrame::isInitialized() {
+    return launchedKernel.isInitialized();
+  }
+
+  occa::kernel kernelFrame::getKernel() {
+    return launchedKernel;
+  }
+
+  int kernelFrame::argumentCount() const {
+    return (int) arguments.size();
+  }
+
+  const std::vector<kernelArg>& kernelFrame::getArguments() const {
+    return arguments;
+  }
+
+  void kernelFrame::setArguments(const kernelArg **args,
+                                 const int argc) {
+    arguments.resize(argc);
+    for (int i = 0; i < argc; ++i) {
+      arguments[i] = *(args[i]);
+    }
+    copyValues();
+  }
+
+  kernelFrame& kernelFrame::setKernel(const occa::kernel &kernel_) {
+    launchedKernel = kernel_;
+    return *this;
+  }
+
+  kernelFrame& kernelFrame::setArg(const int argPos,
+                                   const kernelArg &arg) {
+    OCCA_ERROR("Kernel frame has [" << arguments.size() << "] arguments,"
+               << " trying to set argument [" << argPos << "]",
+               (0 <= argPos) && (argPos < (int) arguments.size()));
+
+    arguments[argPos] = arg;
+    copyValues();
+    return *this;
+  }
+
+  void kernelFrame::run() {
+    modeKernel_t *modeKernel = launchedKernel.getModeKernel();
+    OCCA_ERROR("Kernel frame not initialized or its kernel has been freed",
+               modeKernel != NULL);
+
+    // Lend the bound arguments to the kernel for the launch
+    modeKernel->arguments.swap(arguments);
+    launchedKernel.run();
+    modeKernel->arguments.swap(arguments);
   }
   //====================================
 
@@ -363,6 +540,253 @@ namespace occa {
   }
   //====================================
 
+  //---[ kernelBatch ]------------------
+  kernelBatch::kernelBatch() {}
+
+  int kernelBatch::size() const {
+    return (int) frames.size();
+  }
+
+  void kernelBatch::clear() {
+    frames.clear();
+  }
+
+  kernelBatch& kernelBatch::add(const kernelFrame &frame) {
+    frames.push_back(frame);
+    return *this;
+  }
+
+  bool kernelBatch::canFuse() {
+    const int frameCount = (int) frames.size();
+    if (frameCount < 2) {
+      return false;
+    }
+
+    modeKernel_t *firstKernel = frames[0].getKernel().getModeKernel();
+    if (!firstKernel) {
+      return false;
+    }
+    // The kernel hash covers the device, source and properties
+    const std::string kernelHash = (
+      firstKernel->properties.get<std::string>("hash")
+    );
+    if (!kernelHash.size()) {
+      return false;
+    }
+
+    std::vector<modeMemory_t*> memories;
+    for (int i = 0; i < frameCount; ++i) {
+      modeKernel_t *modeKernel = frames[i].getKernel().getModeKernel();
+      // Fused kernels are generated from the original source
+      if (!modeKernel
+          || (modeKernel->modeDevice != firstKernel->modeDevice)
+          || (modeKernel->sourceFilename != firstKernel->sourceFilename)
+          || (modeKernel->properties.get<std::string>("hash") != kernelHash)) {
+        return false;
+      }
+
+      // Arguments are matched by name
+      const lang::kernelMetadata &metadata = modeKernel->metadata;
+      const int argCount = frames[i].argumentCount();
+      if ((int) metadata.arguments.size() != argCount) {
+        return false;
+      }
+      for (int ai = 0; ai < argCount; ++ai) {
+        if (!metadata.arguments[ai].name.size()) {
+          return false;
+        }
+      }
+
+      const std::vector<kernelArg> &arguments = frames[i].getArguments();
+      for (int ai = 0; ai < argCount; ++ai) {
+        const kArgVector &args = arguments[ai].args;
+        for (int j = 0; j < args.size(); ++j) {
+          if (args[j].modeMemory) {
+            memories.push_back(args[j].modeMemory);
+          }
+        }
+      }
+    }
+
+    // Element-wise fusion is only safe if buffers are either the same
+    //   or don't overlap
+    const int memoryCount = (int) memories.size();
+    for (int i = 0; i < memoryCount; ++i) {
+      const char *ptrA = memories[i]->ptr;
+      const udim_t bytesA = memories[i]->size;
+      for (int j = (i + 1); j < memoryCount; ++j) {
+        const char *ptrB = memories[j]->ptr;
+        const udim_t bytesB = memories[j]->size;
+        if ((ptrA == ptrB) && (bytesA == bytesB)) {
+          continue;
+        }
+        if ((ptrA < (ptrB + bytesB)) && (ptrB < (ptrA + bytesA))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  occa::kernel kernelBatch::getFusedKernel() {
+    occa::kernel firstKernel = frames[0].getKernel();
+    modeKernel_t *modeKernel = firstKernel.getModeKernel();
+
+    strVector kernelNames;
+    const int frameCount = (int) frames.size();
+    for (int i = 0; i < frameCount; ++i) {
+      kernelNames.push_back(frames[i].getKernel().name());
+    }
+
+    const std::string name = (
+      lang::transforms::kernelFuser::fusedKernelName(kernelNames)
+    );
+    // Kernels with the same names can come from different sources
+    //   or properties, which the kernel hash covers
+    const std::string key = (
+      name + ":" + modeKernel->properties.get<std::string>("hash")
+    );
+    if (key != fusedKey) {
+      occa::properties props = modeKernel->properties;
+      props.remove("hash");
+      props.remove("build");
+      json &fuseNames = props["okl/fuse"].asArray();
+      for (int i = 0; i < frameCount; ++i) {
+        fuseNames += kernelNames[i];
+      }
+
+      fusedKey = key;
+      // Cached sources (e.g. from buildKernelFromString) share their
+      //   output directory, rebuild them from their content instead
+      const std::string &filename = modeKernel->sourceFilename;
+      if (startsWith(filename, io::cachePath())) {
+        fusedBuilder = kernelBuilder::fromString(io::read(filename),
+                                                 name,
+                                                 props);
+      } else {
+        fusedBuilder = kernelBuilder::fromFile(filename,
+                                               name,
+                                               props);
+      }
+    }
+    return fusedBuilder.build(firstKernel.getDevice());
+  }
+
+  bool kernelBatch::getFusedArguments(occa::kernel fusedKernel,
+                                      std::vector<const kernelArg*> &args) {
+    const std::string prefix = "_occa_fused";
+    const lang::kernelMetadata &fusedMetadata = (
+      fusedKernel.getModeKernel()->metadata
+    );
+
+    // Fused arguments are either X from the first kernel
+    //   or _occa_fused<k>_X from the k-th kernel
+    const int fusedArgCount = (int) fusedMetadata.arguments.size();
+    for (int i = 0; i < fusedArgCount; ++i) {
+      std::string name = fusedMetadata.arguments[i].name;
+      int frameIndex = 0;
+
+      if (startsWith(name, prefix)) {
+        const char *c = name.c_str() + prefix.size();
+        const char *cStart = c;
+        lex::skipTo(c, '_');
+        frameIndex = occa::atoi(std::string(cStart, c - cStart));
+        name = name.substr(c - name.c_str() + 1);
+      }
+
+      const int argIndex = getArgumentIndex(
+        frames[frameIndex].getKernel().getModeKernel()->metadata,
+        name
+      );
+      if (argIndex < 0) {
+        return false;
+      }
+      args.push_back(&(frames[frameIndex].getArguments()[argIndex]));
+    }
+
+    // Arguments missing in the fused kernel were merged with the
+    //   previous kernel's loop bounds, make sure they match
+    const int frameCount = (int) frames.size();
+    for (int i = 1; i < frameCount; ++i) {
+      const lang::kernelMetadata &metadata = (
+        frames[i].getKernel().getModeKernel()->metadata
+      );
+      const lang::kernelMetadata &prevMetadata = (
+        frames[i - 1].getKernel().getModeKernel()->metadata
+      );
+
+      const int argCount = (int) metadata.arguments.size();
+      for (int ai = 0; ai < argCount; ++ai) {
+        const std::string &name = metadata.arguments[ai].name;
+        const std::string fusedArgName = (
+          lang::transforms::kernelFuser::fusedArgumentName(i, name)
+        );
+        if (getArgumentIndex(fusedMetadata, fusedArgName) >= 0) {
+          continue;
+        }
+
+        const int prevIndex = getArgumentIndex(prevMetadata, name);
+        if ((prevIndex < 0)
+            || !argumentsMatch(frames[i].getArguments()[ai],
+                               frames[i - 1].getArguments()[prevIndex])) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  void kernelBatch::run() {
+    if (canFuse()) {
+      occa::kernel fusedKernel = getFusedKernel();
+      std::vector<const kernelArg*> args;
+
+      if (fusedKernel.isInitialized()
+          && getFusedArguments(fusedKernel, args)) {
+        kernelFrame fusedFrame(fusedKernel);
+        fusedFrame.setArguments(&(args[0]),
+                                (int) args.size());
+        fusedFrame.run();
+        return;
+      }
+    }
+
+    const int frameCount = (int) frames.size();
+    for (int i = 0; i < frameCount; ++i) {
+      frames[i].run();
+    }
+  }
+
+  int kernelBatch::getArgumentIndex(const lang::kernelMetadata &metadata,
+                                    const std::string &name) {
+    const int argCount = (int) metadata.arguments.size();
+    for (int i = 0; i < argCount; ++i) {
+      if (metadata.arguments[i].name == name) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  bool kernelBatch::argumentsMatch(const kernelArg &a,
+                                   const kernelArg &b) {
+    const int argCount = a.args.size();
+    if (argCount != b.args.size()) {
+      return false;
+    }
+    for (int i = 0; i < argCount; ++i) {
+      const kernelArgData &argA = a.args[i];
+      const kernelArgData &argB = b.args[i];
+      if ((argA.modeMemory != argB.modeMemory)
+          || (argA.size != argB.size)
+          || ::memcmp(argA.ptr(), argB.ptr(), argA.size)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  //====================================
+
 
   //---[ Kernel Properties ]------------
   // defines       : Object
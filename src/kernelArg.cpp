@@ -55,6 +55,81 @@ namespace occa {
     return ((info & kArgInfo::usePointer) ? data.void_ : (void*) &data);
   }
 
+  kArgVector::kArgVector() :
+    heapArgs(NULL),
+    size_(0),
+    capacity(1) {}
+
+  kArgVector::kArgVector(const kArgVector &other) :
+    heapArgs(NULL),
+    size_(0),
+    capacity(1) {
+    *this = other;
+  }
+
+  kArgVector& kArgVector::operator = (const kArgVector &other) {
+    if (this == &other) {
+      return *this;
+    }
+    clear();
+    const int otherSize = other.size_;
+    for (int i = 0; i < otherSize; ++i) {
+      push_back(other[i]);
+    }
+    return *this;
+  }
+
+  kArgVector::~kArgVector() {
+    delete [] heapArgs;
+  }
+
+  int kArgVector::size() const {
+    return size_;
+  }
+
+  void kArgVector::clear() {
+    // Keep the capacity for the next use
+    size_ = 0;
+  }
+
+  void kArgVector::push_back(const kernelArgData &arg) {
+    if (size_ == capacity) {
+      const int newCapacity = 2 * capacity;
+      kernelArgData *newArgs = new kernelArgData[newCapacity];
+      for (int i = 0; i < size_; ++i) {
+        newArgs[i] = (*this)[i];
+      }
+      delete [] heapArgs;
+      heapArgs = newArgs;
+      capacity = newCapacity;
+    }
+    (*this)[size_++] = arg;
+  }
+
+  kernelArgData& kArgVector::operator [] (const int index) {
+    return (heapArgs ? heapArgs[index] : inlineArg);
+  }
+
+  const kernelArgData& kArgVector::operator [] (const int index) const {
+    return (heapArgs ? heapArgs[index] : inlineArg);
+  }
+
+  kArgVectorIterator kArgVector::begin() {
+    return (heapArgs ? heapArgs : &inlineArg);
+  }
+
+  kArgVectorIterator kArgVector::end() {
+    return begin() + size_;
+  }
+
+  cKArgVectorIterator kArgVector::begin() const {
+    return (heapArgs ? heapArgs : &inlineArg);
+  }
+
+  cKArgVectorIterator kArgVector::end() const {
+    return begin() + size_;
+  }
+
   kernelArg::kernelArg() {}
   kernelArg::~kernelArg() {}
 
@@ -168,10 +243,7 @@ namespace occa {
     if (argIsUva) {
       modeMemory = (modeMemory_t*) arg;
     } else if (lookAtUva) {
-      ptrRangeMap::iterator it = uvaMap.find(arg);
-      if (it != uvaMap.end()) {
-        modeMemory = it->second;
-      }
+      modeMemory = uvaMap.find(arg);
     }
 
     if (modeMemory) {
@@ -185,6 +257,15 @@ namespace occa {
     }
   }
 
+  void kernelArg::addValue(void *arg, size_t bytes) {
+    kernelArgData kArg;
+    kArg.data.void_ = arg;
+    kArg.size       = bytes;
+    kArg.info       = (kArgInfo::usePointer |
+                       kArgInfo::isValue);
+    args.push_back(kArg);
+  }
+
   void kernelArg::setupForKernelCall(const bool isConst) const {
     const int argCount = (int) args.size();
     for (int i = 0; i < argCount; ++i) {
@@ -199,9 +280,8 @@ namespace occa {
         modeMemory->copyFrom(modeMemory->uvaPtr, modeMemory->size);
         modeMemory->memInfo |= uvaFlag::inDevice;
       }
-      if (!isConst && !modeMemory->isStale()) {
-        uvaStaleMemory.push_back(modeMemory);
-        modeMemory->memInfo |= uvaFlag::isStale;
+      if (!isConst) {
+        modeMemory->modeDevice->addStaleMemory(modeMemory);
       }
     }
   }
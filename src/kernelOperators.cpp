@@ -4,177 +4,147 @@
 //  EDIT: scripts/setup_kernel_operators.py
 // =========================================
 void kernel::operator() () const {
-  modeKernel->arguments.clear();
+  setArguments(NULL, 0);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1) const {
-  kernelArg args[] = {
-    arg1
+  const kernelArg *args[] = {
+    &arg1
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(1);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 1);
+  setArguments(args, 1);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2) const {
-  kernelArg args[] = {
-    arg1, arg2
+  const kernelArg *args[] = {
+    &arg1, &arg2
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(2);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 2);
+  setArguments(args, 2);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(3);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 3);
+  setArguments(args, 3);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(4);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 4);
+  setArguments(args, 4);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(5);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 5);
+  setArguments(args, 5);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(6);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 6);
+  setArguments(args, 6);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(7);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 7);
+  setArguments(args, 7);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(8);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 8);
+  setArguments(args, 8);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(9);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 9);
+  setArguments(args, 9);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(10);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 10);
+  setArguments(args, 10);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(11);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 11);
+  setArguments(args, 11);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(12);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 12);
+  setArguments(args, 12);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(13);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 13);
+  setArguments(args, 13);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(14);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 14);
+  setArguments(args, 14);
   run();
 }
 
 void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(15);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 15);
+  setArguments(args, 15);
   run();
 }
 
@@ -182,13 +152,11 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(16);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 16);
+  setArguments(args, 16);
   run();
 }
 
@@ -196,13 +164,11 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(17);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 17);
+  setArguments(args, 17);
   run();
 }
 
@@ -210,13 +176,11 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(18);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 18);
+  setArguments(args, 18);
   run();
 }
 
@@ -224,13 +188,11 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(19);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 19);
+  setArguments(args, 19);
   run();
 }
 
@@ -238,13 +200,11 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(20);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 20);
+  setArguments(args, 20);
   run();
 }
 
@@ -253,14 +213,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(21);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 21);
+  setArguments(args, 21);
   run();
 }
 
@@ -269,14 +227,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(22);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 22);
+  setArguments(args, 22);
   run();
 }
 
@@ -285,14 +241,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(23);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 23);
+  setArguments(args, 23);
   run();
 }
 
@@ -301,14 +255,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(24);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 24);
+  setArguments(args, 24);
   run();
 }
 
@@ -317,14 +269,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(25);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 25);
+  setArguments(args, 25);
   run();
 }
 
@@ -334,14 +284,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(26);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 26);
+  setArguments(args, 26);
   run();
 }
 
@@ -351,14 +299,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(27);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 27);
+  setArguments(args, 27);
   run();
 }
 
@@ -368,14 +314,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(28);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 28);
+  setArguments(args, 28);
   run();
 }
 
@@ -385,14 +329,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(29);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 29);
+  setArguments(args, 29);
   run();
 }
 
@@ -402,14 +344,12 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(30);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 30);
+  setArguments(args, 30);
   run();
 }
 
@@ -420,15 +360,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(31);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 31);
+  setArguments(args, 31);
   run();
 }
 
@@ -439,15 +377,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(32);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 32);
+  setArguments(args, 32);
   run();
 }
 
@@ -458,15 +394,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(33);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 33);
+  setArguments(args, 33);
   run();
 }
 
@@ -477,15 +411,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(34);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 34);
+  setArguments(args, 34);
   run();
 }
 
@@ -496,15 +428,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(35);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 35);
+  setArguments(args, 35);
   run();
 }
 
@@ -516,15 +446,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(36);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 36);
+  setArguments(args, 36);
   run();
 }
 
@@ -536,15 +464,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(37);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 37);
+  setArguments(args, 37);
   run();
 }
 
@@ -556,15 +482,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(38);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 38);
+  setArguments(args, 38);
   run();
 }
 
@@ -576,15 +500,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(39);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 39);
+  setArguments(args, 39);
   run();
 }
 
@@ -596,15 +518,13 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(40);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 40);
+  setArguments(args, 40);
   run();
 }
 
@@ -617,16 +537,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(41);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 41);
+  setArguments(args, 41);
   run();
 }
 
@@ -639,16 +557,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(42);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 42);
+  setArguments(args, 42);
   run();
 }
 
@@ -661,16 +577,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42, arg43
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(43);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 43);
+  setArguments(args, 43);
   run();
 }
 
@@ -683,16 +597,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42, arg43, arg44
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(44);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 44);
+  setArguments(args, 44);
   run();
 }
 
@@ -705,16 +617,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42, arg43, arg44, arg45
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(45);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 45);
+  setArguments(args, 45);
   run();
 }
 
@@ -728,16 +638,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
                          const kernelArg &arg46) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42, arg43, arg44, arg45, arg46
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(46);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 46);
+  setArguments(args, 46);
   run();
 }
 
@@ -751,16 +659,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
                          const kernelArg &arg46, const kernelArg &arg47) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42, arg43, arg44, arg45, arg46, arg47
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46, &arg47
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(47);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 47);
+  setArguments(args, 47);
   run();
 }
 
@@ -774,16 +680,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
                          const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46, &arg47, &arg48
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(48);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 48);
+  setArguments(args, 48);
   run();
 }
 
@@ -797,16 +701,14 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
                          const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48, const kernelArg &arg49) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46, &arg47, &arg48, &arg49
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(49);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 49);
+  setArguments(args, 49);
   run();
 }
 
@@ -820,16 +722,793 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
                          const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
                          const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
                          const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48, const kernelArg &arg49, const kernelArg &arg50) const {
-  kernelArg args[] = {
-    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
-    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
-    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
-    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
-    arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46, &arg47, &arg48, &arg49, &arg50
   };
-  modeKernel->arguments.clear();
-  modeKernel->arguments.reserve(50);
-  modeKernel->arguments.insert(modeKernel->arguments.begin(), args, args + 50);
+  setArguments(args, 50);
   run();
 }
 
+kernelFrame kernel::bind() const {
+  return kernelFrame(*this);
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1) const {
+  const kernelArg *args[] = {
+    &arg1
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 1);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 2);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 3);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 4);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 5);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 6);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 7);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 8);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 9);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 10);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 11);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 12);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 13);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 14);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 15);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 16);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 17);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 18);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 19);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 20);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 21);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 22);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 23);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 24);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 25);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 26);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 27);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 28);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 29);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 30);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 31);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 32);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 33);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 34);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 35);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 36);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 37);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 38);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 39);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 40);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 41);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 42);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 43);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 44);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 45);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                         const kernelArg &arg46) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 46);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                         const kernelArg &arg46, const kernelArg &arg47) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46, &arg47
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 47);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                         const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46, &arg47, &arg48
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 48);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                         const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48, const kernelArg &arg49) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46, &arg47, &arg48, &arg49
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 49);
+  return frame;
+}
+
+kernelFrame kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                         const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                         const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                         const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                         const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                         const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                         const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                         const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                         const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                         const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48, const kernelArg &arg49, const kernelArg &arg50) const {
+  const kernelArg *args[] = {
+    &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8, &arg9, &arg10,
+    &arg11, &arg12, &arg13, &arg14, &arg15, &arg16, &arg17, &arg18, &arg19, &arg20,
+    &arg21, &arg22, &arg23, &arg24, &arg25, &arg26, &arg27, &arg28, &arg29, &arg30,
+    &arg31, &arg32, &arg33, &arg34, &arg35, &arg36, &arg37, &arg38, &arg39, &arg40,
+    &arg41, &arg42, &arg43, &arg44, &arg45, &arg46, &arg47, &arg48, &arg49, &arg50
+  };
+  kernelFrame frame(*this);
+  frame.setArguments(args, 50);
+  return frame;
+}
+
@@ -0,0 +1,265 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/defines.hpp>
+
+#include <cstdlib>
+#if (OCCA_OS == OCCA_WINDOWS_OS)
+#  include <malloc.h>
+#endif
+
+#include <occa/lang/arena.hpp>
+
+namespace occa {
+  namespace lang {
+    //---[ Arena ]----------------------
+    const size_t arena_t::alignment;
+    const size_t arena_t::maxBytes;
+    const size_t arena_t::slabBytes;
+    const int    arena_t::sizeClasses;
+
+    arena_t::arena_t() :
+      slabStart(NULL),
+      slabEnd(NULL),
+      liveBlocks(0),
+      remoteBlocks(NULL),
+      hasRemoteBlocks(0) {
+      for (int i = 0; i < sizeClasses; ++i) {
+        freeBlocks[i] = NULL;
+      }
+    }
+
+    arena_t::~arena_t() {
+      const int slabCount = (int) slabs.size();
+      for (int i = 0; i < slabCount; ++i) {
+        freeSlab(slabs[i]);
+      }
+      remoteMutex.free();
+    }
+
+    arena_t& arena_t::get() {
+      // Never destroyed, objects can be freed during static destruction
+      static tls<arenaHandle_t> *handle = new tls<arenaHandle_t>();
+      return *(handle->value().arena);
+    }
+
+    char* arena_t::allocSlab() {
+      void *slab = NULL;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      if (::posix_memalign(&slab, slabBytes, slabBytes)) {
+        slab = NULL;
+      }
+#else
+      slab = ::_aligned_malloc(slabBytes, slabBytes);
+#endif
+      if (!slab) {
+        throw std::bad_alloc();
+      }
+      return (char*) slab;
+    }
+
+    void arena_t::freeSlab(char *slab) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      ::free(slab);
+#else
+      ::_aligned_free(slab);
+#endif
+    }
+
+    arena_t* arena_t::slabOwner(void *ptr) {
+      const size_t slab = ((size_t) ptr) & ~(slabBytes - 1);
+      return *((arena_t**) slab);
+    }
+
+    void* arena_t::alloc(const size_t bytes) {
+      if (bytes > maxBytes) {
+        return ::operator new(bytes);
+      }
+      const int sizeClass = (int) ((bytes + alignment - 1) / alignment) - 1;
+
+      freeBlock_t *block = freeBlocks[sizeClass];
+      if (!block && __atomic_load_n(&hasRemoteBlocks, __ATOMIC_ACQUIRE)) {
+        takeRemoteBlocks();
+        block = freeBlocks[sizeClass];
+      }
+      ++liveBlocks;
+      if (block) {
+        freeBlocks[sizeClass] = block->next;
+        return block;
+      }
+
+      const size_t blockBytes = (sizeClass + 1) * alignment;
+      if ((size_t) (slabEnd - slabStart) < blockBytes) {
+        // The tail of the old slab is too small to be worth keeping
+        char *slab = allocSlab();
+        *((arena_t**) slab) = this;
+        slabs.push_back(slab);
+        slabStart = slab + alignment;
+        slabEnd   = slab + slabBytes;
+      }
+      void *ptr = slabStart;
+      slabStart += blockBytes;
+      return ptr;
+    }
+
+    void arena_t::free(void *ptr, const size_t bytes) {
+      if (!ptr) {
+        return;
+      }
+      if (bytes > maxBytes) {
+        ::operator delete(ptr);
+        return;
+      }
+      const int sizeClass = (int) ((bytes + alignment - 1) / alignment) - 1;
+
+      arena_t *owner = slabOwner(ptr);
+      if (owner == this) {
+        freeOwnBlock(ptr, sizeClass);
+      } else {
+        owner->freeRemoteBlock(ptr, sizeClass);
+      }
+    }
+
+    void arena_t::freeOwnBlock(void *ptr, const int sizeClass) {
+      freeBlock_t *block = (freeBlock_t*) ptr;
+      block->next = freeBlocks[sizeClass];
+      freeBlocks[sizeClass] = block;
+
+      // Keep one slab around for the next burst of allocations
+      if (!--liveBlocks) {
+        freeSlabs(true);
+      }
+    }
+
+    void arena_t::freeRemoteBlock(void *ptr, const int sizeClass) {
+      remoteBlock_t *block = (remoteBlock_t*) ptr;
+      block->sizeClass = sizeClass;
+
+      remoteMutex.lock();
+      block->next = remoteBlocks;
+      remoteBlocks = block;
+      __atomic_store_n(&hasRemoteBlocks, 1, __ATOMIC_RELEASE);
+      remoteMutex.unlock();
+    }
+
+    void arena_t::takeRemoteBlocks() {
+      remoteMutex.lock();
+      remoteBlock_t *block = remoteBlocks;
+      remoteBlocks = NULL;
+      __atomic_store_n(&hasRemoteBlocks, 0, __ATOMIC_RELEASE);
+      remoteMutex.unlock();
+
+      while (block) {
+        remoteBlock_t *next = block->next;
+        const int sizeClass = block->sizeClass;
+        freeBlock_t *freeBlock = (freeBlock_t*) block;
+        freeBlock->next = freeBlocks[sizeClass];
+        freeBlocks[sizeClass] = freeBlock;
+        --liveBlocks;
+        block = next;
+      }
+    }
+
+    void arena_t::freeSlabs(const bool keepSlab) {
+      // Every block is back in the free lists, which point into the slabs
+      for (int i = 0; i < sizeClasses; ++i) {
+        freeBlocks[i] = NULL;
+      }
+      char *keptSlab = NULL;
+      if (keepSlab && slabs.size()) {
+        keptSlab = slabs.back();
+        slabs.pop_back();
+      }
+      const int slabCount = (int) slabs.size();
+      for (int i = 0; i < slabCount; ++i) {
+        freeSlab(slabs[i]);
+      }
+      slabs.clear();
+
+      if (keptSlab) {
+        slabs.push_back(keptSlab);
+        slabStart = keptSlab + alignment;
+        slabEnd   = keptSlab + slabBytes;
+      } else {
+        slabStart = slabEnd = NULL;
+      }
+    }
+
+    void arena_t::release() {
+      if (__atomic_load_n(&hasRemoteBlocks, __ATOMIC_ACQUIRE)) {
+        takeRemoteBlocks();
+      }
+      if (!liveBlocks) {
+        freeSlabs(false);
+      }
+    }
+
+    size_t arena_t::bytesReserved() const {
+      return slabs.size() * slabBytes;
+    }
+    //==================================
+
+    //---[ Handle ]---------------------
+    arenaHandle_t::arenaHandle_t() {
+      acquire();
+    }
+
+    arenaHandle_t::arenaHandle_t(const arenaHandle_t &other) {
+      acquire();
+    }
+
+    void arenaHandle_t::acquire() {
+      mutex &idleMutex_ = idleMutex();
+      std::vector<arena_t*> &idleArenas_ = idleArenas();
+
+      idleMutex_.lock();
+      if (idleArenas_.size()) {
+        arena = idleArenas_.back();
+        idleArenas_.pop_back();
+      } else {
+        arena = new arena_t();
+      }
+      idleMutex_.unlock();
+    }
+
+    arenaHandle_t::~arenaHandle_t() {
+      // Idle arenas only keep slabs with blocks other threads still use
+      arena->release();
+
+      mutex &idleMutex_ = idleMutex();
+      idleMutex_.lock();
+      idleArenas().push_back(arena);
+      idleMutex_.unlock();
+    }
+
+    // Both are leaked on purpose, threads can exit during static destruction
+    mutex& arenaHandle_t::idleMutex() {
+      static mutex *mutex_ = new mutex();
+      return *mutex_;
+    }
+
+    std::vector<arena_t*>& arenaHandle_t::idleArenas() {
+      static std::vector<arena_t*> *arenas = new std::vector<arena_t*>();
+      return *arenas;
+    }
+    //==================================
+  }
+}
@@ -148,7 +148,11 @@ namespace occa {
         // Expression
         if (smnt.type() & statementType::expression) {
           expressionStatement &exprSmnt = (expressionStatement&) smnt;
-          exprSmnt.expr = exprTransform::apply(*(exprSmnt.expr));
+          exprNode *newExpr = exprTransform::apply(*(exprSmnt.expr));
+          if (!newExpr) {
+            return NULL;
+          }
+          exprSmnt.expr = newExpr;
           return &smnt;
         }
 
@@ -160,6 +164,10 @@ namespace occa {
           nextExprIsBeingDeclared = true;
           exprNode *newNode = exprTransform::apply(*funcNode);
           nextExprIsBeingDeclared = false;
+          if (!newNode) {
+            delete funcNode;
+            return NULL;
+          }
           // Update variable
           if (newNode != funcNode) {
             if (newNode->type() & exprNodeType::function) {
@@ -184,6 +192,10 @@ namespace occa {
           nextExprIsBeingDeclared = true;
           exprNode *newNode = exprTransform::apply(*varNode);
           nextExprIsBeingDeclared = false;
+          if (!newNode) {
+            delete varNode;
+            return NULL;
+          }
           // Update variable
           if (newNode != varNode) {
             if (newNode->type() & exprNodeType::variable) {
@@ -193,7 +205,11 @@ namespace occa {
           delete newNode;
           // Update value exprNodes
           if (decl.value) {
-            decl.value = exprTransform::apply(*(decl.value));
+            exprNode *newValue = exprTransform::apply(*(decl.value));
+            if (!newValue) {
+              return NULL;
+            }
+            decl.value = newValue;
           }
         }
 
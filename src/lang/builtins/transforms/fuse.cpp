@@ -0,0 +1,375 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <algorithm>
+
+#include <occa/lang/exprNode.hpp>
+#include <occa/lang/variable.hpp>
+#include <occa/lang/mode/okl.hpp>
+#include <occa/lang/mode/oklForStatement.hpp>
+#include <occa/lang/builtins/transforms/finders.hpp>
+#include <occa/lang/builtins/transforms/fuse.hpp>
+#include <occa/lang/builtins/transforms/replacer.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace transforms {
+      kernelFuser::kernelFuser(blockStatement &root_) :
+        root(root_),
+        fusedSmnt(NULL),
+        fusedForSmnt(NULL),
+        fusedIterator(NULL),
+        leaderForSmnt(NULL) {}
+
+      std::string kernelFuser::fusedKernelName(const strVector &kernelNames) {
+        std::string name = "_occa_fused";
+        const int kernelCount = (int) kernelNames.size();
+        for (int i = 0; i < kernelCount; ++i) {
+          name += '_';
+          name += kernelNames[i];
+        }
+        return name;
+      }
+
+      std::string kernelFuser::fusedArgumentName(const int kernelIndex,
+                                                 const std::string &name) {
+        if (!kernelIndex) {
+          return name;
+        }
+        return "_occa_fused" + occa::toString(kernelIndex) + "_" + name;
+      }
+
+      bool kernelFuser::exprMatcher(exprNode &expr) {
+        return true;
+      }
+
+      bool kernelFuser::apply(const strVector &kernelNames) {
+        if (!findKernels(kernelNames)) {
+          return false;
+        }
+
+        setupFusedKernel(fusedKernelName(kernelNames));
+
+        const int kernelCount = (int) kernelSmnts.size();
+        for (int i = 0; i < kernelCount; ++i) {
+          fuseKernel(i);
+        }
+
+        root.add(*fusedSmnt);
+        fusedSmnt->updateScope(true);
+        return true;
+      }
+
+      bool kernelFuser::findKernels(const strVector &kernelNames) {
+        statementPtrVector smnts;
+        findStatementsByAttr(statementType::functionDecl,
+                             "kernel",
+                             root,
+                             smnts);
+
+        const int kernelCount = (int) kernelNames.size();
+        const int smntCount = (int) smnts.size();
+        for (int i = 0; i < kernelCount; ++i) {
+          functionDeclStatement *kernelSmnt = NULL;
+          for (int j = 0; j < smntCount; ++j) {
+            functionDeclStatement &smnt = *((functionDeclStatement*) smnts[j]);
+            if (smnt.function.name() == kernelNames[i]) {
+              kernelSmnt = &smnt;
+              break;
+            }
+          }
+          if (!kernelSmnt) {
+            occa::printError("Unable to fuse missing @kernel ["
+                             + kernelNames[i] + "]");
+            return false;
+          }
+          kernelSmnts.push_back(kernelSmnt);
+        }
+
+        if (!kernelCount) {
+          occa::printError("No @kernels given to fuse");
+          return false;
+        }
+        return true;
+      }
+
+      void kernelFuser::setupFusedKernel(const std::string &name) {
+        functionDeclStatement &firstSmnt = *(kernelSmnts[0]);
+
+        function_t &fusedFunction = (function_t&) firstSmnt.function.clone();
+        fusedFunction.source->value = name;
+
+        fusedSmnt = new functionDeclStatement(&root,
+                                              fusedFunction);
+        fusedSmnt->attributes = firstSmnt.attributes;
+      }
+
+      void kernelFuser::fuseKernel(const int kernelIndex) {
+        functionDeclStatement &kernelSmnt = *(kernelSmnts[kernelIndex]);
+        function_t &function = kernelSmnt.function;
+        function_t &fusedFunction = fusedSmnt->function;
+
+        forStatement *forSmnt = getFusableLoop(kernelSmnt);
+        const bool mergeLoop = (forSmnt && canMergeLoop(*forSmnt));
+
+        strVector headerNames;
+        if (mergeLoop) {
+          getHeaderVariables(*forSmnt, headerNames);
+        }
+
+        // Find the fused argument for each kernel argument
+        argumentVariableMap kernelArgs;
+        variablePtrVector fusedArgs;
+        const int argCount = (int) function.args.size();
+        for (int i = 0; i < argCount; ++i) {
+          variable_t &arg = *(function.args[i]);
+          const std::string &name = arg.name();
+
+          if (mergeLoop
+              && (std::find(headerNames.begin(), headerNames.end(), name)
+                  != headerNames.end())) {
+            argumentVariableMap::iterator it = previousArgs.find(name);
+            if (it != previousArgs.end()) {
+              kernelArgs[name] = it->second;
+              fusedArgs.push_back(it->second);
+              continue;
+            }
+          }
+
+          if (kernelIndex) {
+            fusedFunction += arg;
+            fusedFunction.args.back()->name() = fusedArgumentName(kernelIndex,
+                                                                  name);
+            fusedArgs.push_back(fusedFunction.args.back());
+          } else {
+            fusedArgs.push_back(fusedFunction.args[i]);
+          }
+          kernelArgs[name] = fusedArgs.back();
+        }
+
+        statement_t *newSmnt;
+        if (mergeLoop) {
+          // Append the loop body to the current fused loop
+          blockStatement &newBlock = *(new blockStatement(fusedForSmnt,
+                                                          *forSmnt));
+          newBlock.attributes.clear();
+          fusedForSmnt->add(newBlock);
+
+          okl::oklForStatement oklForSmnt(*forSmnt, "", false);
+          replaceVariables(newBlock,
+                           *oklForSmnt.iterator,
+                           *fusedIterator);
+          newSmnt = &newBlock;
+        } else if (forSmnt) {
+          // Start a new fused loop
+          forStatement &newForSmnt = (forStatement&) forSmnt->clone(fusedSmnt);
+          fusedSmnt->add(newForSmnt);
+
+          okl::oklForStatement oklForSmnt(newForSmnt, "", false);
+          fusedForSmnt = &newForSmnt;
+          fusedIterator = oklForSmnt.iterator;
+          leaderForSmnt = forSmnt;
+          newSmnt = &newForSmnt;
+        } else {
+          // Run the kernel body as-is
+          blockStatement &newBlock = *(new blockStatement(fusedSmnt,
+                                                          kernelSmnt));
+          newBlock.attributes.clear();
+          fusedSmnt->add(newBlock);
+
+          fusedForSmnt = NULL;
+          fusedIterator = NULL;
+          leaderForSmnt = NULL;
+          newSmnt = &newBlock;
+        }
+
+        for (int i = 0; i < argCount; ++i) {
+          replaceVariables(*newSmnt,
+                           *(function.args[i]),
+                           *(fusedArgs[i]));
+        }
+
+        previousArgs = kernelArgs;
+      }
+
+      forStatement* kernelFuser::getFusableLoop(functionDeclStatement &kernelSmnt) {
+        if ((kernelSmnt.size() != 1)
+            || !(kernelSmnt.children[0]->type() & statementType::for_)) {
+          return NULL;
+        }
+
+        forStatement &forSmnt = *((forStatement*) kernelSmnt.children[0]);
+        if (!forSmnt.hasAttribute("tile")
+            || !okl::oklForStatement::isValid(forSmnt, "", false)) {
+          return NULL;
+        }
+
+        // Only plain element-wise loops can be merged
+        statementPtrVector smnts;
+        const int childCount = forSmnt.size();
+        for (int i = 0; i < childCount; ++i) {
+          statement_t &child = *(forSmnt.children[i]);
+          findStatements(statementType::all,
+                         child,
+                         okl::oklLoopMatcher,
+                         smnts);
+          findStatementsByAttr(statementType::all,
+                               "tile",
+                               child,
+                               smnts);
+          findStatementsByAttr(statementType::all,
+                               "barrier",
+                               child,
+                               smnts);
+          findStatements((statementType::declaration |
+                          statementType::expression),
+                         child,
+                         okl::oklSharedMatcher,
+                         smnts);
+          findStatements((statementType::declaration |
+                          statementType::expression),
+                         child,
+                         okl::oklExclusiveMatcher,
+                         smnts);
+        }
+        if (smnts.size()) {
+          return NULL;
+        }
+
+        okl::oklForStatement oklForSmnt(forSmnt, "", false);
+        if (!isElementWise(kernelSmnt, forSmnt, *oklForSmnt.iterator)) {
+          return NULL;
+        }
+        return &forSmnt;
+      }
+
+      bool kernelFuser::canMergeLoop(forStatement &forSmnt) {
+        return (leaderForSmnt
+                && (getHeaderSource(forSmnt)
+                    == getHeaderSource(*leaderForSmnt)));
+      }
+
+      bool kernelFuser::isElementWise(functionDeclStatement &kernelSmnt,
+                                      forStatement &forSmnt,
+                                      variable_t &iterator) {
+        exprNodeVector nodes;
+        const int childCount = forSmnt.size();
+        for (int i = 0; i < childCount; ++i) {
+          statementExprMap exprMap;
+          findStatements((exprNodeType::variable |
+                          exprNodeType::subscript),
+                         *(forSmnt.children[i]),
+                         exprMatcher,
+                         exprMap);
+
+          statementExprMap::iterator it = exprMap.begin();
+          while (it != exprMap.end()) {
+            nodes.insert(nodes.end(),
+                         it->second.begin(), it->second.end());
+            ++it;
+          }
+        }
+
+        // Pointer arguments can only be accessed through ptr[iterator]
+        //   which keeps each iteration independent of the others
+        function_t &function = kernelSmnt.function;
+        const int argCount = (int) function.args.size();
+        const int nodeCount = (int) nodes.size();
+        for (int ai = 0; ai < argCount; ++ai) {
+          variable_t &arg = *(function.args[ai]);
+          if (!arg.vartype.isPointerType()) {
+            continue;
+          }
+
+          int uses = 0;
+          int elementUses = 0;
+          for (int i = 0; i < nodeCount; ++i) {
+            exprNode &node = *(nodes[i]);
+            if (node.type() & exprNodeType::variable) {
+              uses += (&(((variableNode&) node).value) == &arg);
+              continue;
+            }
+            subscriptNode &subNode = (subscriptNode&) node;
+            if (!(subNode.value->type() & exprNodeType::variable)
+                || !(subNode.index->type() & exprNodeType::variable)) {
+              continue;
+            }
+            variable_t &value = ((variableNode*) subNode.value)->value;
+            variable_t &index = ((variableNode*) subNode.index)->value;
+            elementUses += ((&value == &arg) && (&index == &iterator));
+          }
+
+          if (uses != elementUses) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      void kernelFuser::getHeaderVariables(forStatement &forSmnt,
+                                           strVector &names) {
+        statement_t *headerSmnts[3] = {
+          forSmnt.init, forSmnt.check, forSmnt.update
+        };
+
+        statementExprMap exprMap;
+        for (int i = 0; i < 3; ++i) {
+          findStatements(exprNodeType::variable,
+                         *(headerSmnts[i]),
+                         exprMatcher,
+                         exprMap);
+        }
+
+        exprNodeVector nodes;
+        statementExprMap::iterator it = exprMap.begin();
+        while (it != exprMap.end()) {
+          nodes.insert(nodes.end(),
+                       it->second.begin(), it->second.end());
+          ++it;
+        }
+
+        attributeToken_t &tileAttr = forSmnt.attributes["tile"];
+        findExprNodesByType(exprNodeType::variable,
+                            *(tileAttr.args[0].expr),
+                            nodes);
+
+        const int nodeCount = (int) nodes.size();
+        for (int i = 0; i < nodeCount; ++i) {
+          names.push_back(((variableNode*) nodes[i])->value.name());
+        }
+      }
+
+      std::string kernelFuser::getHeaderSource(forStatement &forSmnt) {
+        attributeToken_t &tileAttr = forSmnt.attributes["tile"];
+        return (forSmnt.init->toString()
+                + forSmnt.check->toString()
+                + forSmnt.update->toString()
+                + tileAttr.args[0].expr->toString());
+      }
+
+      bool applyFuseTransforms(blockStatement &root,
+                               const strVector &kernelNames) {
+        kernelFuser fuser(root);
+        return fuser.apply(kernelNames);
+      }
+    }
+  }
+}
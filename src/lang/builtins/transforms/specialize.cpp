@@ -0,0 +1,208 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/lang/exprNode.hpp>
+#include <occa/lang/statement.hpp>
+#include <occa/lang/variable.hpp>
+#include <occa/lang/builtins/types.hpp>
+#include <occa/lang/builtins/transforms/specialize.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace transforms {
+      specializedArgReplacer_t::specializedArgReplacer_t(const variable_t &arg_,
+                                                         const primitive &value_) :
+        statementExprTransform(exprNodeType::variable   |
+                               exprNodeType::leftUnary  |
+                               exprNodeType::rightUnary |
+                               exprNodeType::binary),
+        arg(&arg_),
+        value(value_) {
+        // Loop attributes such as @tile(N) can also use the argument
+        validStatementTypes |= statementType::for_;
+      }
+
+      statement_t* specializedArgReplacer_t::transformStatement(statement_t &smnt) {
+        if (!(smnt.type() & statementType::for_)) {
+          return statementExprTransform::transformStatement(smnt);
+        }
+
+        attributeTokenMap &attributes = smnt.attributes;
+        attributeTokenMap::iterator it = attributes.begin();
+        while (it != attributes.end()) {
+          attributeArgVector &args = it->second.args;
+          const int argCount = (int) args.size();
+          for (int i = 0; i < argCount; ++i) {
+            if (!args[i].expr) {
+              continue;
+            }
+            exprNode *newExpr = exprTransform::apply(*(args[i].expr));
+            if (!newExpr) {
+              return NULL;
+            }
+            args[i].expr = newExpr;
+          }
+          ++it;
+        }
+        return &smnt;
+      }
+
+      exprNode* specializedArgReplacer_t::transformExprNode(exprNode &node) {
+        if (!(node.type() & exprNodeType::variable)) {
+          if (modifiesValue(node)) {
+            arg->printError("Specialized argument [" + arg->name() + "]"
+                            " cannot be modified");
+            return NULL;
+          }
+          return &node;
+        }
+
+        variable_t &var = ((variableNode&) node).value;
+        if (&var != arg) {
+          return &node;
+        }
+        exprNode *valueNode = new primitiveNode(node.token, value);
+        valueNodes.insert(valueNode);
+        return valueNode;
+      }
+
+      bool specializedArgReplacer_t::isValueNode(exprNode *node) const {
+        while (node->type() & exprNodeType::parentheses) {
+          node = ((parenthesesNode*) node)->value;
+        }
+        return valueNodes.find(node) != valueNodes.end();
+      }
+
+      bool specializedArgReplacer_t::modifiesValue(exprNode &node) const {
+        const udim_t nodeType = node.type();
+        if (nodeType & exprNodeType::leftUnary) {
+          leftUnaryOpNode &opNode = (leftUnaryOpNode&) node;
+          return ((opNode.opType() & (operatorType::increment |
+                                      operatorType::decrement |
+                                      operatorType::address))
+                  && isValueNode(opNode.value));
+        }
+        if (nodeType & exprNodeType::rightUnary) {
+          rightUnaryOpNode &opNode = (rightUnaryOpNode&) node;
+          return ((opNode.opType() & (operatorType::increment |
+                                      operatorType::decrement))
+                  && isValueNode(opNode.value));
+        }
+        binaryOpNode &opNode = (binaryOpNode&) node;
+        return ((opNode.opType() & operatorType::assignment)
+                && isValueNode(opNode.leftValue));
+      }
+
+      specialize::specialize(const json &values_) :
+        values(values_) {
+        validStatementTypes = statementType::functionDecl;
+      }
+
+      statement_t* specialize::transformStatement(statement_t &smnt) {
+        if (!smnt.hasAttribute("kernel")) {
+          return &smnt;
+        }
+        functionDeclStatement &kernelSmnt = (functionDeclStatement&) smnt;
+        variablePtrVector &args = kernelSmnt.function.args;
+
+        for (int i = 0; i < (int) args.size(); ++i) {
+          const std::string name = args[i]->name();
+          if (!values.has(name)) {
+            continue;
+          }
+          if (!specializeArgument(kernelSmnt, i)) {
+            return NULL;
+          }
+          specializedNames.insert(name);
+          // The argument was removed
+          --i;
+        }
+        return &smnt;
+      }
+
+      bool specialize::specializeArgument(functionDeclStatement &kernelSmnt,
+                                          const int argIndex) {
+        variablePtrVector &args = kernelSmnt.function.args;
+        variable_t &arg = *(args[argIndex]);
+        const std::string name = arg.name();
+        const json &argValue = values[name];
+
+        if (arg.vartype.isPointerType()
+            || arg.vartype.referenceToken) {
+          arg.printError("Only scalar arguments can be specialized");
+          return false;
+        }
+        primitive value;
+        if (argValue.isNumber()) {
+          value = argValue.number();
+        } else if (argValue.isBoolean()) {
+          value = argValue.boolean();
+        } else {
+          arg.printError("Specialized value for [" + name + "] must be"
+                         " a number or boolean");
+          return false;
+        }
+        // Keep the argument's precision, a double literal would
+        //   promote float math to double
+        const type_t *argType = arg.vartype.type;
+        if (argType == &float_) {
+          value = (float) value;
+        } else if (argType == &double_) {
+          value = (double) value;
+        } else if (argType == &bool_) {
+          value = (bool) value;
+        }
+
+        specializedArgReplacer_t replacer(arg, value);
+        if (!replacer.statementTransform::apply(kernelSmnt)) {
+          return false;
+        }
+
+        // The scope owns the argument variable
+        args.erase(args.begin() + argIndex);
+        kernelSmnt.scope.remove(name);
+        return true;
+      }
+
+      bool specialize::hasUnusedValues() const {
+        bool hasUnused = false;
+        const jsonObject &valueMap = values.object();
+        jsonObject::const_iterator it = valueMap.begin();
+        while (it != valueMap.end()) {
+          if (specializedNames.find(it->first) == specializedNames.end()) {
+            occa::printError("Unable to specialize missing @kernel argument ["
+                             + it->first + "]");
+            hasUnused = true;
+          }
+          ++it;
+        }
+        return hasUnused;
+      }
+
+      bool applySpecializeTransforms(statement_t &smnt,
+                                     const json &values) {
+        specialize specializeTransform(values);
+        return (specializeTransform.apply(smnt)
+                && !specializeTransform.hasUnusedValues());
+      }
+    }
+  }
+}
@@ -0,0 +1,122 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/lang/exprNode.hpp>
+#include <occa/lang/statement.hpp>
+#include <occa/lang/builtins/transforms/tune.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace transforms {
+      tune::tune(const occa::properties &settings_,
+                 kernelTunableMap &tunables_) :
+        settings(settings_),
+        tunables(tunables_) {
+        downToUp = false;
+        validStatementTypes = statementType::for_;
+      }
+
+      statement_t* tune::transformStatement(statement_t &smnt) {
+        forStatement &forSmnt = (forStatement&) smnt;
+        attributeTokenMap::iterator it = forSmnt.attributes.find("tile");
+        if (it == forSmnt.attributes.end()) {
+          return &smnt;
+        }
+        attributeToken_t &attr = it->second;
+        if (!attr.args.size()
+            || !attr.args[0].expr
+            || !isTuneCall(*(attr.args[0].expr))) {
+          return &smnt;
+        }
+
+        callNode &call = *((callNode*) attr.args[0].expr);
+        const int optionCount = (int) call.args.size();
+        if (!optionCount) {
+          call.printError("TUNE() requires at least one option");
+          return NULL;
+        }
+
+        functionDeclStatement *kernelSmnt = getKernel(smnt);
+        if (!kernelSmnt) {
+          call.printError("TUNE() can only be used inside @kernels");
+          return NULL;
+        }
+        const std::string &kernelName = kernelSmnt->function.name();
+
+        // Store the options for the tuner
+        std::vector<strVector> &kernelTunables = tunables[kernelName];
+        const int tunableIndex = (int) kernelTunables.size();
+        kernelTunables.push_back(strVector());
+        strVector &options = kernelTunables.back();
+        for (int i = 0; i < optionCount; ++i) {
+          options.push_back(call.args[i]->toString());
+        }
+
+        int option = 0;
+        const std::string key = "okl/tune/" + kernelName;
+        if (settings.has(key)) {
+          const json &choices = settings[key];
+          if (tunableIndex < choices.size()) {
+            option = (int) choices[tunableIndex];
+          }
+        }
+        if ((option < 0) || (optionCount <= option)) {
+          call.printError("TUNE() option [" + occa::toString(option)
+                          + "] is out of bounds");
+          return NULL;
+        }
+
+        exprNode *value = call.args[option]->clone();
+        delete attr.args[0].expr;
+        attr.args[0].expr = value;
+
+        return &smnt;
+      }
+
+      bool tune::isTuneCall(exprNode &expr) {
+        if (!(expr.type() & exprNodeType::call)) {
+          return false;
+        }
+        callNode &call = (callNode&) expr;
+        return (call.value->toString() == "TUNE");
+      }
+
+      functionDeclStatement* tune::getKernel(statement_t &smnt) {
+        statement_t *up = &smnt;
+        while (up) {
+          if ((up->type() & statementType::functionDecl)
+              && up->hasAttribute("kernel")) {
+            return (functionDeclStatement*) up;
+          }
+          up = up->up;
+        }
+        return NULL;
+      }
+
+      bool applyTuneTransforms(statement_t &smnt,
+                               const occa::properties &settings,
+                               kernelTunableMap &tunables) {
+        tune tuneTransform(settings, tunables);
+        return tuneTransform.apply(smnt);
+      }
+    }
+  }
+}
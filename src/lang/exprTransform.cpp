@@ -45,7 +45,8 @@ namespace occa {
       exprNode *newNode = &node;
       if (node.type() & validExprNodeTypes) {
         newNode = transformExprNode(node);
-        if (newNode != &node) {
+        // Failed transforms leave the node in place
+        if (newNode && (newNode != &node)) {
           delete &node;
         }
       }
@@ -0,0 +1,207 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/io.hpp>
+#include <occa/lang/headerCache.hpp>
+#include <occa/lang/token.hpp>
+#include <occa/lang/tokenizer.hpp>
+
+namespace occa {
+  namespace lang {
+    //---[ Cached Header ]--------------
+    cachedHeader_t::cachedHeader_t(const std::string &filename,
+                                   const hash_t &hash_) :
+      hash(hash_),
+      file(new file_t(filename)),
+      pragmaOnce(false) {
+      // Tokens get cloned across threads, the cache owns the file
+      file->dontUseRefs();
+
+      tokenizer_t tokenizer(file);
+      token_t *token;
+      while (!tokenizer.isEmpty()) {
+        tokenizer.setNext(token);
+        tokens.push_back(token);
+      }
+      errors = tokenizer.errors;
+
+      replayable = canReplay();
+      findGuards();
+    }
+
+    cachedHeader_t::~cachedHeader_t() {
+      const int tokenCount = (int) tokens.size();
+      for (int i = 0; i < tokenCount; ++i) {
+        delete tokens[i];
+      }
+      delete file;
+    }
+
+    bool cachedHeader_t::canReplay() const {
+      if (errors) {
+        return false;
+      }
+      const int tokenCount = (int) tokens.size();
+      for (int i = 0; i < (tokenCount - 1); ++i) {
+        token_t *token = tokens[i];
+        if (!(token->type() & tokenType::op)
+            || (token->to<operatorToken>().opType() != operatorType::hash)) {
+          continue;
+        }
+        token_t *directive = tokens[i + 1];
+        if (!(directive->type() & tokenType::identifier)) {
+          continue;
+        }
+        const std::string &name = directive->to<identifierToken>().value;
+        if ((name == "include") || (name == "line")) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    void cachedHeader_t::findGuards() {
+      // Split non-empty lines
+      std::vector<tokenVector> lines(1);
+      const int tokenCount = (int) tokens.size();
+      for (int i = 0; i < tokenCount; ++i) {
+        token_t *token = tokens[i];
+        if (token->type() & tokenType::newline) {
+          if (lines.back().size()) {
+            lines.push_back(tokenVector());
+          }
+          continue;
+        }
+        lines.back().push_back(token);
+      }
+      if (!lines.back().size()) {
+        lines.pop_back();
+      }
+
+      const int lineCount = (int) lines.size();
+      for (int i = 0; i < lineCount; ++i) {
+        const tokenVector &line = lines[i];
+        if (isDirective(line, "pragma")
+            && (line.size() == 3)
+            && (line[2]->type() & tokenType::identifier)
+            && (line[2]->to<identifierToken>().value == "once")) {
+          pragmaOnce = true;
+        }
+      }
+
+      // #ifndef FOO
+      // #define FOO
+      // ...
+      // #endif
+      if ((lineCount < 3)
+          || !isDirective(lines[0], "ifndef")
+          || !isDirective(lines[1], "define")) {
+        return;
+      }
+      const std::string name = directiveArg(lines[0]);
+      if (!name.size()
+          || (name != directiveArg(lines[1]))) {
+        return;
+      }
+      // The #endif closing the #ifndef has to be the last line
+      //   and an #else or #elif branch would still be used on re-includes
+      int depth = 0;
+      for (int i = 0; i < lineCount; ++i) {
+        const tokenVector &line = lines[i];
+        if (isDirective(line, "if")
+            || isDirective(line, "ifdef")
+            || isDirective(line, "ifndef")) {
+          ++depth;
+        } else if ((depth == 1)
+                   && (isDirective(line, "else")
+                       || isDirective(line, "elif"))) {
+          return;
+        } else if (isDirective(line, "endif")) {
+          --depth;
+          if (!depth) {
+            if (i == (lineCount - 1)) {
+              guardName = name;
+            }
+            return;
+          }
+        }
+      }
+    }
+
+    bool cachedHeader_t::isDirective(const tokenVector &line,
+                                     const std::string &name) {
+      return ((line.size() >= 2)
+              && (line[0]->type() & tokenType::op)
+              && (line[0]->to<operatorToken>().opType() == operatorType::hash)
+              && (line[1]->type() & tokenType::identifier)
+              && (line[1]->to<identifierToken>().value == name));
+    }
+
+    std::string cachedHeader_t::directiveArg(const tokenVector &line) {
+      if ((line.size() < 3)
+          || !(line[2]->type() & tokenType::identifier)) {
+        return "";
+      }
+      return line[2]->to<identifierToken>().value;
+    }
+    //==================================
+
+    //---[ Header Cache ]---------------
+    headerCache_t::headerCache_t() {}
+
+    headerCache_t& headerCache_t::get() {
+      // Never destroyed, cached tokens can outlive static destruction
+      static headerCache_t *cache = new headerCache_t();
+      return *cache;
+    }
+
+    cachedHeader_t* headerCache_t::getHeader(const std::string &filename) {
+      const hash_t hash = occa::hashFile(filename);
+
+      headerMutex.lock();
+      cachedHeaderMap::iterator it = headers.find(filename);
+      if ((it != headers.end())
+          && (it->second->hash == hash)) {
+        cachedHeader_t *header = it->second;
+        headerMutex.unlock();
+        return header;
+      }
+      headerMutex.unlock();
+
+      // Tokenize outside the lock, losing a race only costs the work
+      cachedHeader_t *header = new cachedHeader_t(filename, hash);
+
+      headerMutex.lock();
+      it = headers.find(filename);
+      if ((it != headers.end())
+          && (it->second->hash == hash)) {
+        // Keep the first one, its tokens might be in use already
+        headerMutex.unlock();
+        delete header;
+        return it->second;
+      }
+      headers[filename] = header;
+      headerMutex.unlock();
+      return header;
+    }
+    //==================================
+  }
+}
@@ -26,16 +26,20 @@
 
 namespace occa {
   namespace lang {
-    argumentInfo::argumentInfo(const bool isConst_) :
-      isConst(isConst_) {}
+    argumentInfo::argumentInfo(const bool isConst_,
+                               const std::string &name_) :
+      isConst(isConst_),
+      name(name_) {}
 
     argumentInfo argumentInfo::fromJson(const json &j) {
-      return argumentInfo((bool) j["const"]);
+      return argumentInfo((bool) j["const"],
+                          j.get<std::string>("name", ""));
     }
 
     json argumentInfo::toJson() const {
       json j;
       j["const"] = isConst;
+      j["name"]  = name;
       return j;
     }
 
@@ -64,6 +68,14 @@ namespace occa {
         meta.arguments.push_back(argumentInfo::fromJson(argInfos[i]));
       }
 
+      if (j.has("tunables")) {
+        const jsonArray &tunables = j["tunables"].array();
+        const int tunableCount = (int) tunables.size();
+        for (int i = 0; i < tunableCount; ++i) {
+          meta.tunables.push_back(tunables[i].getArray<std::string>());
+        }
+      }
+
       return meta;
     }
 
@@ -78,6 +90,20 @@ namespace occa {
         argInfos += arguments[k].toJson();
       }
 
+      const int tunableCount = (int) tunables.size();
+      if (tunableCount) {
+        json &tunableInfos = j["tunables"].asArray();
+        for (int k = 0; k < tunableCount; ++k) {
+          json options;
+          options.asArray();
+          const int optionCount = (int) tunables[k].size();
+          for (int i = 0; i < optionCount; ++i) {
+            options += tunables[k][i];
+          }
+          tunableInfos += options;
+        }
+      }
+
       return j;
     }
 
@@ -268,21 +268,25 @@ namespace occa {
           return NULL;
         }
 
-        exprNode *initInParen = initValue->wrapInParentheses();
+        // Positive: check - (init)
+        // Negative: init - (check)
+        exprNode *lowerInParen = (positiveUpdate
+                                  ? initValue
+                                  : checkValue)->wrapInParentheses();
         exprNode *count = (
           new binaryOpNode(iterator->source,
-                           positiveUpdate ? op::sub : op::add,
-                           *checkValue,
-                           *initInParen)
+                           op::sub,
+                           positiveUpdate ? *checkValue : *initValue,
+                           *lowerInParen)
         );
-        delete initInParen;
+        delete lowerInParen;
 
         if (checkIsInclusive) {
           primitiveNode inc(iterator->source, 1);
 
           exprNode *countWithInc = (
             new binaryOpNode(iterator->source,
-                             positiveUpdate ? op::sub : op::add,
+                             op::add,
                              *count,
                              inc)
           );
@@ -293,13 +297,14 @@ namespace occa {
         if (updateValue) {
           exprNode *updateInParen = updateValue->wrapInParentheses();
 
+          // (count + update - 1) / update
           primitiveNode one(iterator->source, 1);
           binaryOpNode boundCheck(iterator->source,
-                                  positiveUpdate ? op::add : op::sub,
+                                  op::add,
                                   *count,
                                   *updateInParen);
           binaryOpNode boundCheck2(iterator->source,
-                                   positiveUpdate ? op::sub : op::add,
+                                   op::sub,
                                    boundCheck,
                                    one);
           exprNode *boundCheckInParen = boundCheck2.wrapInParentheses();
@@ -312,6 +317,7 @@ namespace occa {
           );
           delete count;
           delete updateInParen;
+          delete boundCheckInParen;
           count = countWithUpdate;
         }
 
@@ -20,6 +20,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 #include <occa/lang/mode/openmp.hpp>
+#include <occa/lang/mode/oklForStatement.hpp>
 #include <occa/lang/builtins/transforms/finders.hpp>
 
 namespace occa {
@@ -31,53 +32,215 @@ namespace occa {
       void openmpParser::afterParsing() {
         serialParser::afterParsing();
 
+        if (!success) return;
+        setupParallelLoops();
+
+        if (!success) return;
+        setupSimdLoops();
+      }
+
+      void openmpParser::setupParallelLoops() {
         statementPtrVector outerSmnts;
         findOuterMostLoops(outerSmnts);
 
         const int count = (int) outerSmnts.size();
         for (int i = 0; i < count; ++i) {
-          statement_t &outerSmnt = *(outerSmnts[i]);
-          statement_t *parent = outerSmnt.up;
-          if (!parent
-              || !parent->is<blockStatement>()) {
+          forStatement &outerSmnt = *((forStatement*) outerSmnts[i]);
+          const std::string pragma = getParallelPragma(outerSmnt);
+          if (!success) return;
+          addPragma(outerSmnt, pragma);
+          if (!success) return;
+        }
+      }
+
+      std::string openmpParser::getParallelPragma(forStatement &outerSmnt) {
+        std::string pragma = "omp parallel for";
+
+        const int depth = getCollapseDepth(outerSmnt);
+        if (depth > 1) {
+          pragma += " collapse(" + occa::toString(depth) + ")";
+        }
+
+        // For example: "static", "dynamic, 4" or "guided"
+        const std::string schedule = settings.get<std::string>("openmp/schedule", "");
+        if (schedule.size()) {
+          const std::string kind = strip(schedule.substr(0, schedule.find(',')));
+          if ((kind != "static")
+              && (kind != "dynamic")
+              && (kind != "guided")
+              && (kind != "auto")
+              && (kind != "runtime")) {
             success = false;
-            outerSmnt.printError("Unable to add [#pragma omp]");
-            return;
+            outerSmnt.printError("Unknown [openmp/schedule] kind [" + kind + "]");
+            return pragma;
+          }
+          pragma += " schedule(" + schedule + ")";
+        }
+
+        return pragma;
+      }
+
+      int openmpParser::getCollapseDepth(forStatement &outerSmnt) {
+        // Perfectly nested @outer loops with bounds that don't
+        //   depend on the enclosing @outer iterators
+        std::vector<variable_t*> iterators;
+        forStatement *forSmnt = &outerSmnt;
+        while (true) {
+          oklForStatement oklForSmnt(*forSmnt, "", false);
+          if (!oklForSmnt.isValid()) {
+            break;
           }
-          // Add OpenMP Pragma
-          blockStatement &outerBlock  = (blockStatement&) outerSmnt;
-          blockStatement &parentBlock = *((blockStatement*) parent);
-          pragmaStatement *pragmaSmnt = (
-            new pragmaStatement((blockStatement*) parent,
-                                pragmaToken(outerBlock.source->origin,
-                                            "omp parallel for"))
-          );
-          parentBlock.addBefore(outerSmnt,
-                                *pragmaSmnt);
+
+          const int iteratorCount = (int) iterators.size();
+          bool isDependent = false;
+          for (int i = 0; i < iteratorCount; ++i) {
+            variable_t &iterator = *(iterators[i]);
+            if (usesVariable(oklForSmnt.initValue, iterator)
+                || usesVariable(oklForSmnt.checkValue, iterator)
+                || usesVariable(oklForSmnt.updateValue, iterator)) {
+              isDependent = true;
+              break;
+            }
+          }
+          if (isDependent) {
+            break;
+          }
+          iterators.push_back(oklForSmnt.iterator);
+
+          if (forSmnt->size() != 1) {
+            break;
+          }
+          statement_t &childSmnt = *((*forSmnt)[0]);
+          if ((childSmnt.type() != statementType::for_)
+              || !childSmnt.hasAttribute("outer")) {
+            break;
+          }
+          forSmnt = (forStatement*) &childSmnt;
         }
+        return (int) iterators.size();
       }
 
-      void openmpParser::findOuterMostLoops(statementPtrVector &outerMostSmnts) {
+      void openmpParser::setupSimdLoops() {
+        if (!settings.get("openmp/simd", true)) {
+          return;
+        }
+
         statementPtrVector outerSmnts;
-        findStatementsByAttr(statementType::for_,
-                             "outer",
-                             root,
-                             outerSmnts);
+        findOuterMostLoops(outerSmnts);
 
         const int count = (int) outerSmnts.size();
         for (int i = 0; i < count; ++i) {
-          statement_t *outerSmnt = outerSmnts[i];
-          statement_t *smnt = outerSmnt->up;
-          while (smnt) {
-            if (smnt->hasAttribute("outer")) {
-              break;
-            }
-            smnt = smnt->up;
+          setupSimdLoops(*((forStatement*) outerSmnts[i]));
+          if (!success) return;
+        }
+      }
+
+      void openmpParser::setupSimdLoops(forStatement &outerSmnt) {
+        // @inner iterations synchronize through barriers and @shared
+        //   memory, keep them in order
+        statementPtrVector barrierSmnts;
+        findStatementsByAttr(statementType::empty,
+                             "barrier",
+                             outerSmnt,
+                             barrierSmnts);
+        if (barrierSmnts.size()) {
+          return;
+        }
+
+        statementExprMap sharedExprMap;
+        findStatements(statementType::declaration,
+                       exprNodeType::variable,
+                       outerSmnt,
+                       sharedVariableMatcher,
+                       sharedExprMap);
+        if (sharedExprMap.size()) {
+          return;
+        }
+
+        statementPtrVector innerSmnts;
+        findStatementsByAttr(statementType::for_,
+                             "inner",
+                             outerSmnt,
+                             innerSmnts);
+
+        const int count = (int) innerSmnts.size();
+        for (int i = 0; i < count; ++i) {
+          forStatement &innerSmnt = *((forStatement*) innerSmnts[i]);
+          if (!canVectorize(innerSmnt)) {
+            continue;
+          }
+          addPragma(innerSmnt, "omp simd");
+          if (!success) return;
+        }
+      }
+
+      bool openmpParser::canVectorize(forStatement &innerSmnt) {
+        // Only inner-most @inner loops
+        statementPtrVector innerSmnts;
+        findStatementsByAttr(statementType::for_,
+                             "inner",
+                             innerSmnt,
+                             innerSmnts);
+        const int innerCount = (int) innerSmnts.size();
+        for (int i = 0; i < innerCount; ++i) {
+          if (innerSmnts[i] != &innerSmnt) {
+            return false;
           }
-          if (!smnt) {
-            outerMostSmnts.push_back(outerSmnt);
+        }
+
+        // @exclusive indices are carried across iterations
+        if (innerSmnt.inScope(exclusiveIndexName)) {
+          return false;
+        }
+
+        // simd loops can't be exited early
+        statementPtrVector jumpSmnts;
+        findStatementsByType((statementType::break_ |
+                              statementType::return_),
+                             innerSmnt,
+                             jumpSmnts);
+        return !jumpSmnts.size();
+      }
+
+      void openmpParser::addPragma(statement_t &smnt,
+                                   const std::string &value) {
+        statement_t *parent = smnt.up;
+        if (!parent
+            || !parent->is<blockStatement>()) {
+          success = false;
+          smnt.printError("Unable to add [#pragma " + value + "]");
+          return;
+        }
+        blockStatement &parentBlock = *((blockStatement*) parent);
+        pragmaStatement *pragmaSmnt = (
+          new pragmaStatement(&parentBlock,
+                              pragmaToken(smnt.source->origin,
+                                          value))
+        );
+        parentBlock.addBefore(smnt,
+                              *pragmaSmnt);
+      }
+
+      bool openmpParser::usesVariable(exprNode *expr,
+                                      variable_t &var) {
+        if (!expr) {
+          return false;
+        }
+        exprNodeVector nodes;
+        findExprNodesByType(exprNodeType::variable,
+                            *expr,
+                            nodes);
+        const int count = (int) nodes.size();
+        for (int i = 0; i < count; ++i) {
+          if (&(((variableNode*) nodes[i])->value) == &var) {
+            return true;
           }
         }
+        return false;
+      }
+
+      bool openmpParser::sharedVariableMatcher(exprNode &expr) {
+        return expr.hasAttribute("shared");
       }
     }
   }
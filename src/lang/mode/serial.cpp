@@ -27,6 +27,8 @@ namespace occa {
   namespace lang {
     namespace okl {
       const std::string serialParser::exclusiveIndexName = "_occa_exclusive_index";
+      const std::string serialParser::trampolinePrefix   = "_occa_trampoline_";
+      const std::string serialParser::trampolineArgsName = "_occa_args";
 
       serialParser::serialParser(const occa::properties &settings_) :
         parser_t(settings_) {
@@ -58,7 +60,12 @@ namespace occa {
           headers.push_back("include <cstdio>");
           headers.push_back("include <cmath>");
         }
-        headers.push_back("include <occa.hpp>");
+        // Kernels only need the vector types, the full API is opt-in
+        if (settings.get("serial/include-occa", false)) {
+          headers.push_back("include <occa.hpp>");
+        } else {
+          headers.push_back("include <occa/mode/serial/runtime.hpp>");
+        }
 
         const int headerCount = (int) headers.size();
         for (int i = 0; i < headerCount; ++i) {
@@ -90,7 +97,14 @@ namespace occa {
                              kernelSmnts);
         const int kernels = (int) kernelSmnts.size();
         for (int i = 0; i < kernels; ++i) {
-          setupKernel(*((functionDeclStatement*) kernelSmnts[i]));
+          functionDeclStatement &kernelSmnt = (
+            *((functionDeclStatement*) kernelSmnts[i])
+          );
+          setupKernel(kernelSmnt);
+          if (!success) {
+            break;
+          }
+          setupKernelTrampoline(kernelSmnt);
           if (!success) {
             break;
           }
@@ -127,6 +141,95 @@ namespace occa {
         }
       }
 
+      void serialParser::setupKernelTrampoline(functionDeclStatement &kernelSmnt) {
+        // extern "C" void _occa_trampoline_foo(void **_occa_args) {
+        //   foo(*(int*) _occa_args[0], (float*) _occa_args[1], ...);
+        // }
+        function_t &func = kernelSmnt.function;
+        const int argCount = (int) func.args.size();
+        for (int i = 0; i < argCount; ++i) {
+          // Array arguments can't be cast to, keep using sys::runFunction
+          if (func.args[i]->vartype.arrays.size()) {
+            return;
+          }
+        }
+
+        const fileOrigin &origin = kernelSmnt.source->origin;
+        identifierToken nameSource(origin, trampolinePrefix + func.name());
+        function_t &trampoline = *(new function_t(
+          vartype_t(identifierToken(origin, "void"), void_),
+          nameSource
+        ));
+        trampoline.returnType.qualifiers.addFirst(origin,
+                                                  externC);
+
+        identifierToken argsSource(origin, trampolineArgsName);
+        variable_t argsVar(
+          vartype_t(identifierToken(origin, "void"), void_),
+          &argsSource
+        );
+        argsVar += pointer_t();
+        argsVar += pointer_t();
+        trampoline += argsVar;
+
+        functionDeclStatement &trampolineSmnt = *(
+          new functionDeclStatement(kernelSmnt.up,
+                                    trampoline)
+        );
+        kernelSmnt.up->addAfter(kernelSmnt,
+                                trampolineSmnt);
+        trampolineSmnt.updateScope(true);
+
+        // Each packed entry points to the argument value,
+        //   pointer arguments are passed as the pointer itself
+        variableNode argsNode(kernelSmnt.source,
+                              *(trampoline.args[0]));
+        exprNodeVector callArgs;
+        for (int i = 0; i < argCount; ++i) {
+          vartype_t argType = func.args[i]->vartype;
+          if (argType.referenceToken) {
+            delete argType.referenceToken;
+            argType.referenceToken = NULL;
+          }
+
+          primitiveNode indexNode(kernelSmnt.source,
+                                  i);
+          subscriptNode entryNode(kernelSmnt.source,
+                                  argsNode,
+                                  indexNode);
+          if (argType.isPointerType()) {
+            callArgs.push_back(
+              new parenCastNode(kernelSmnt.source,
+                                argType,
+                                entryNode)
+            );
+            continue;
+          }
+
+          argType += pointer_t();
+          parenCastNode castNode(kernelSmnt.source,
+                                 argType,
+                                 entryNode);
+          callArgs.push_back(
+            new leftUnaryOpNode(kernelSmnt.source,
+                                op::dereference,
+                                castNode)
+          );
+        }
+
+        functionNode kernelNode(kernelSmnt.source,
+                                func);
+        callNode call(kernelSmnt.source,
+                      kernelNode,
+                      callArgs);
+        freeExprNodeVector(callArgs);
+
+        trampolineSmnt.add(
+          *(new expressionStatement(&trampolineSmnt,
+                                    *(call.clone())))
+        );
+      }
+
       void serialParser::setupExclusives() {
         // Get @exclusive declarations
         statementExprMap exprMap;
@@ -298,6 +401,29 @@ namespace occa {
         }
       }
 
+      void serialParser::findOuterMostLoops(statementPtrVector &outerMostSmnts) {
+        statementPtrVector outerSmnts;
+        findStatementsByAttr(statementType::for_,
+                             "outer",
+                             root,
+                             outerSmnts);
+
+        const int count = (int) outerSmnts.size();
+        for (int i = 0; i < count; ++i) {
+          statement_t *outerSmnt = outerSmnts[i];
+          statement_t *smnt = outerSmnt->up;
+          while (smnt) {
+            if (smnt->hasAttribute("outer")) {
+              break;
+            }
+            smnt = smnt->up;
+          }
+          if (!smnt) {
+            outerMostSmnts.push_back(outerSmnt);
+          }
+        }
+      }
+
       exprNode* serialParser::updateExclusiveExprNodes(statement_t &smnt,
                                                        exprNode &expr,
                                                        const bool isBeingDeclared) {
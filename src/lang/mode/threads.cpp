@@ -0,0 +1,396 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <map>
+
+#include <occa/lang/mode/threads.hpp>
+#include <occa/lang/mode/oklForStatement.hpp>
+#include <occa/lang/builtins/types.hpp>
+#include <occa/lang/builtins/transforms/finders.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace okl {
+      const std::string threadsParser::threadInfoName = "_occa_thread_info";
+
+      threadsParser::threadsParser(const occa::properties &settings_) :
+        serialParser(settings_) {}
+
+      void threadsParser::afterParsing() {
+        // Added before the serial setup so kernel trampolines forward it
+        if (!success) return;
+        setupThreadInfoArgs();
+
+        serialParser::afterParsing();
+
+        if (!success) return;
+        setupOuterStatementGuards();
+
+        if (!success) return;
+        setupChunkedLoops();
+      }
+
+      void threadsParser::setupThreadInfoArgs() {
+        statementPtrVector kernelSmnts;
+        findStatementsByAttr(statementType::functionDecl,
+                             "kernel",
+                             root,
+                             kernelSmnts);
+
+        const int kernels = (int) kernelSmnts.size();
+        for (int i = 0; i < kernels; ++i) {
+          functionDeclStatement &kernelSmnt = (
+            *((functionDeclStatement*) kernelSmnts[i])
+          );
+          function_t &func = kernelSmnt.function;
+
+          // Appended last to keep the user argument indices
+          const fileOrigin &origin = kernelSmnt.source->origin;
+          identifierToken varSource(origin, threadInfoName);
+          variable_t &infoVar = *(new variable_t(
+            vartype_t(identifierToken(origin, "int"), int_),
+            &varSource
+          ));
+          infoVar += pointer_t();
+
+          func.args.push_back(&infoVar);
+          kernelSmnt.scope.add(infoVar);
+        }
+      }
+
+      void threadsParser::setupOuterStatementGuards() {
+        statementPtrVector outerSmnts;
+        findOuterMostLoops(outerSmnts);
+
+        statementPtrVector kernelSmnts;
+        findStatementsByAttr(statementType::functionDecl,
+                             "kernel",
+                             root,
+                             kernelSmnts);
+
+        const int kernels = (int) kernelSmnts.size();
+        for (int i = 0; i < kernels; ++i) {
+          setupOuterStatementGuards(
+            *((functionDeclStatement*) kernelSmnts[i]),
+            outerSmnts
+          );
+          if (!success) return;
+        }
+      }
+
+      void threadsParser::setupOuterStatementGuards(functionDeclStatement &kernelSmnt,
+                                                    statementPtrVector &outerSmnts) {
+        // Count the outer-most loops inside each kernel statement
+        std::map<statement_t*, int> loopCounts;
+        const int outerCount = (int) outerSmnts.size();
+        for (int i = 0; i < outerCount; ++i) {
+          statement_t *smnt = outerSmnts[i];
+          while (smnt && (smnt->up != &kernelSmnt)) {
+            smnt = smnt->up;
+          }
+          if (smnt) {
+            ++loopCounts[smnt];
+          }
+        }
+
+        variable_t &infoVar = *(kernelSmnt.function.args.back());
+
+        int loopIndex = 0;
+        const int smntCount = (int) kernelSmnt.children.size();
+        for (int i = 0; i < smntCount; ++i) {
+          statement_t *smnt = kernelSmnt.children[i];
+          std::map<statement_t*, int>::iterator it = loopCounts.find(smnt);
+          if (it != loopCounts.end()) {
+            loopIndex += it->second;
+            continue;
+          }
+          // Declarations are needed by every call
+          if (smnt->type() & statementType::declaration) {
+            continue;
+          }
+
+          bool writesOuterVariables = false;
+          bool needsGuard = writesMemory(*smnt, writesOuterVariables);
+          if (smnt->type() & statementType::expression) {
+            exprNode *expr = ((expressionStatement*) smnt)->expr;
+            needsGuard = (needsGuard
+                          || (expr && (expr->type() & exprNodeType::call)));
+          }
+          if (!needsGuard) {
+            continue;
+          }
+          if (writesOuterVariables) {
+            success = false;
+            smnt->printError("Statements outside [@outer] loops can't write"
+                             " to memory and to variables declared outside"
+                             " of them in Threads mode");
+            return;
+          }
+
+          // if (info[0] == -(loop + 1)) { smnt }
+          token_t *source = smnt->source;
+          exprNode *loopEntry = threadInfoEntry(source, infoVar, 0);
+          primitiveNode queryIndex(source, -(loopIndex + 1));
+
+          ifStatement &guardSmnt = *(new ifStatement(&kernelSmnt, source));
+          guardSmnt.setCondition(
+            new expressionStatement(&guardSmnt,
+                                    *(new binaryOpNode(source,
+                                                       op::equal,
+                                                       *loopEntry,
+                                                       queryIndex)),
+                                    false)
+          );
+          kernelSmnt.children[i] = &guardSmnt;
+          guardSmnt.add(*smnt);
+
+          delete loopEntry;
+        }
+      }
+
+      bool threadsParser::writesMemory(statement_t &smnt,
+                                       bool &writesOuterVariables) {
+        // Variables declared inside [smnt] don't outlive it
+        std::map<variable_t*, bool> innerVariables;
+        statementPtrVector declSmnts;
+        findStatementsByType(statementType::declaration,
+                             smnt,
+                             declSmnts);
+        const int declSmntCount = (int) declSmnts.size();
+        for (int i = 0; i < declSmntCount; ++i) {
+          variableDeclarationVector &decls = (
+            ((declarationStatement*) declSmnts[i])->declarations
+          );
+          const int declCount = (int) decls.size();
+          for (int d = 0; d < declCount; ++d) {
+            innerVariables[decls[d].variable] = true;
+          }
+        }
+
+        statementExprMap exprMap;
+        findStatements((exprNodeType::leftUnary
+                        | exprNodeType::rightUnary
+                        | exprNodeType::binary),
+                       smnt,
+                       isUpdateOp,
+                       exprMap);
+
+        bool writes = false;
+        statementExprMap::iterator it = exprMap.begin();
+        while (it != exprMap.end()) {
+          exprNodeVector &updates = it->second;
+          const int updateCount = (int) updates.size();
+          for (int i = 0; i < updateCount; ++i) {
+            exprNode *value = getUpdatedValue(*(updates[i]));
+            // Locals and local arrays, everything else points to memory
+            variable_t *var = NULL;
+            bool isSubscript = false;
+            while (value) {
+              if (value->type() & exprNodeType::parentheses) {
+                value = ((parenthesesNode*) value)->value;
+              } else if (value->type() & exprNodeType::subscript) {
+                value = ((subscriptNode*) value)->value;
+                isSubscript = true;
+              } else {
+                if (value->type() & exprNodeType::variable) {
+                  var = &(((variableNode*) value)->value);
+                }
+                break;
+              }
+            }
+            const bool isLocal = (
+              var
+              && (!isSubscript
+                  || (!var->vartype.pointers.size()
+                      && var->vartype.arrays.size()))
+            );
+            if (!isLocal) {
+              writes = true;
+            } else if (innerVariables.find(var) == innerVariables.end()) {
+              writesOuterVariables = true;
+            }
+          }
+          ++it;
+        }
+        return writes;
+      }
+
+      exprNode* threadsParser::getUpdatedValue(exprNode &expr) {
+        if (expr.type() & exprNodeType::binary) {
+          return ((binaryOpNode&) expr).leftValue;
+        }
+        if (expr.type() & exprNodeType::leftUnary) {
+          return ((leftUnaryOpNode&) expr).value;
+        }
+        return ((rightUnaryOpNode&) expr).value;
+      }
+
+      bool threadsParser::isUpdateOp(exprNode &expr) {
+        const opType_t opType = ((exprOpNode&) expr).opType();
+        return (opType & (operatorType::assignment
+                          | operatorType::increment
+                          | operatorType::decrement));
+      }
+
+      void threadsParser::setupChunkedLoops() {
+        statementPtrVector outerSmnts;
+        findOuterMostLoops(outerSmnts);
+
+        // Loops are indexed in source order per kernel
+        std::map<statement_t*, int> loopCounts;
+
+        const int count = (int) outerSmnts.size();
+        for (int i = 0; i < count; ++i) {
+          forStatement &forSmnt = *((forStatement*) outerSmnts[i]);
+
+          statement_t *smnt = forSmnt.up;
+          while (smnt
+                 && (smnt->type() != statementType::functionDecl)) {
+            smnt = smnt->up;
+          }
+          if (!smnt) {
+            success = false;
+            forSmnt.printError("[@outer] loop is not inside a [@kernel]");
+            return;
+          }
+
+          function_t &func = ((functionDeclStatement*) smnt)->function;
+          variable_t &infoVar = *(func.args.back());
+
+          setupChunkedLoop(forSmnt,
+                           infoVar,
+                           loopCounts[smnt]++);
+          if (!success) return;
+        }
+      }
+
+      void threadsParser::setupChunkedLoop(forStatement &forSmnt,
+                                           variable_t &infoVar,
+                                           const int loopIndex) {
+        oklForStatement oklForSmnt(forSmnt);
+        if (!oklForSmnt.isValid()) {
+          success = false;
+          return;
+        }
+
+        token_t *source = forSmnt.source;
+        blockStatement &parent = *(forSmnt.up);
+        variableNode iteratorNode(source, *(oklForSmnt.iterator));
+
+        exprNode *loopEntry  = threadInfoEntry(source, infoVar, 0);
+        exprNode *startEntry = threadInfoEntry(source, infoVar, 1);
+        exprNode *endEntry   = threadInfoEntry(source, infoVar, 2);
+        exprNode *countEntry = threadInfoEntry(source, infoVar, 3);
+        exprNode *foundEntry = threadInfoEntry(source, infoVar, 4);
+
+        // if (info[0] == -(loop + 1)) { info[3] = count; info[4] = 1; }
+        primitiveNode queryIndex(source, -(loopIndex + 1));
+        primitiveNode one(source, 1);
+        exprNode *iterationCount = oklForSmnt.getIterationCount();
+
+        ifStatement &querySmnt = *(new ifStatement(&parent, source));
+        querySmnt.setCondition(
+          new expressionStatement(&querySmnt,
+                                  *(new binaryOpNode(source,
+                                                     op::equal,
+                                                     *loopEntry,
+                                                     queryIndex)),
+                                  false)
+        );
+        querySmnt.add(
+          *(new expressionStatement(&querySmnt,
+                                    *(new binaryOpNode(source,
+                                                       op::assign,
+                                                       *countEntry,
+                                                       *iterationCount))))
+        );
+        querySmnt.add(
+          *(new expressionStatement(&querySmnt,
+                                    *(new binaryOpNode(source,
+                                                       op::assign,
+                                                       *foundEntry,
+                                                       one))))
+        );
+        parent.addBefore(forSmnt, querySmnt);
+
+        // Start from info[1] and add the loop and chunk-end checks
+        exprNode *startValue = oklForSmnt.makeDeclarationValue(*startEntry);
+        exprNode *endValue = oklForSmnt.makeDeclarationValue(*endEntry);
+
+        primitiveNode loopIndexNode(source, loopIndex);
+        binaryOpNode loopCheck(source,
+                               op::equal,
+                               *loopEntry,
+                               loopIndexNode);
+        binaryOpNode chunkCheck(source,
+                                (oklForSmnt.positiveUpdate
+                                 ? op::lessThan
+                                 : op::greaterThan),
+                                iteratorNode,
+                                *endValue);
+
+        expressionStatement &checkSmnt = *((expressionStatement*) forSmnt.check);
+        exprNode *loopCheckInParen  = loopCheck.wrapInParentheses();
+        exprNode *checkInParen      = checkSmnt.expr->wrapInParentheses();
+        exprNode *chunkCheckInParen = chunkCheck.wrapInParentheses();
+
+        binaryOpNode firstChecks(source,
+                                 op::and_,
+                                 *loopCheckInParen,
+                                 *checkInParen);
+        exprNode *newCheck = new binaryOpNode(source,
+                                              op::and_,
+                                              firstChecks,
+                                              *chunkCheckInParen);
+
+        variableDeclaration &decl = (
+          ((declarationStatement*) forSmnt.init)->declarations[0]
+        );
+        delete decl.value;
+        decl.value = startValue;
+
+        delete checkSmnt.expr;
+        checkSmnt.expr = newCheck;
+
+        delete loopEntry;
+        delete startEntry;
+        delete endEntry;
+        delete countEntry;
+        delete foundEntry;
+        delete iterationCount;
+        delete endValue;
+        delete loopCheckInParen;
+        delete checkInParen;
+        delete chunkCheckInParen;
+      }
+
+      exprNode* threadsParser::threadInfoEntry(token_t *source,
+                                               variable_t &infoVar,
+                                               const int index) {
+        variableNode infoNode(source, infoVar);
+        primitiveNode indexNode(source, index);
+        return new subscriptNode(source,
+                                 infoNode,
+                                 indexNode);
+      }
+    }
+  }
+}
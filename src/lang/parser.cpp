@@ -147,14 +147,29 @@ namespace occa {
         kernelMetadata &metadata = metadataMap[func.name()];
         metadata.name = func.name();
 
+        kernelTunableMap::const_iterator it = tunables.find(func.name());
+        if (it != tunables.end()) {
+          metadata.tunables = it->second;
+        }
+
         int args = (int) func.args.size();
         for (int ai = 0; ai < args; ++ai) {
           metadata += argumentInfo(
-            func.args[ai]->has(const_)
+            func.args[ai]->has(const_),
+            func.args[ai]->name()
           );
         }
       }
     }
+
+    void parser_t::setDependencies(strVector &dependencies) const {
+      dependencies.clear();
+      strToBoolMap::const_iterator it = preprocessor.dependencies.begin();
+      while (it != preprocessor.dependencies.end()) {
+        dependencies.push_back(it->first);
+        ++it;
+      }
+    }
     //==================================
 
     //---[ Setup ]----------------------
@@ -177,6 +192,7 @@ namespace occa {
       upStack.clear();
 
       clearAttributes();
+      tunables.clear();
 
       onClear();
 
@@ -284,8 +300,24 @@ namespace occa {
       if (!success) return;
       loadAllStatements();
       if (!success) return;
+      if (settings.has("okl/specialize")) {
+        success = transforms::applySpecializeTransforms(
+          root,
+          settings["okl/specialize"]
+        );
+        if (!success) return;
+      }
+      if (settings.has("okl/fuse")) {
+        success = transforms::applyFuseTransforms(
+          root,
+          settings.getArray<std::string>("okl/fuse")
+        );
+        if (!success) return;
+      }
       success = transforms::applyDimTransforms(root);
       if (!success) return;
+      success = transforms::applyTuneTransforms(root, settings, tunables);
+      if (!success) return;
       success = transforms::applyTileTransforms(root);
       if (!success) return;
       afterParsing();
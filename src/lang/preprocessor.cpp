@@ -32,6 +32,7 @@
 #include <occa/lang/preprocessor.hpp>
 #include <occa/lang/specialMacros.hpp>
 #include <occa/lang/expression.hpp>
+#include <occa/lang/headerCache.hpp>
 #include <occa/lang/tokenizer.hpp>
 
 namespace occa {
@@ -959,6 +960,8 @@ namespace occa {
         return;
       }
 
+      cachedHeader_t &cachedHeader = *(headerCache_t::get().getHeader(header));
+      const bool alreadyIncluded = (dependencies.find(header) != dependencies.end());
       dependencies[header] = true;
 
       tokenVector lineTokens;
@@ -989,8 +992,20 @@ namespace occa {
         inputCache.pop_front();
       }
 
+      // Skip headers that would expand to nothing
+      if ((cachedHeader.pragmaOnce && alreadyIncluded)
+          || (cachedHeader.guardName.size()
+              && getMacro(cachedHeader.guardName))) {
+        tokenizer->rewindOutputCache();
+        return;
+      }
+
       // Push source after updating origin to the [\n] token
-      tokenizer->pushSource(header);
+      if (cachedHeader.replayable) {
+        tokenizer->pushTokens(cachedHeader.tokens);
+      } else {
+        tokenizer->pushSource(header);
+      }
     }
 
     void preprocessor_t::processPragma(identifierToken &directive) {
@@ -19,12 +19,22 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
+#include <cstring>
+
 #include <occa/tools/string.hpp>
 #include <occa/lang/tokenizer.hpp>
 #include <occa/lang/token.hpp>
 
 namespace occa {
   namespace lang {
+    namespace charClass {
+      const unsigned char whitespace      = (1 << 0);
+      const unsigned char identifierStart = (1 << 1);
+      const unsigned char identifier      = (1 << 2);
+      const unsigned char operatorStart   = (1 << 3);
+      const unsigned char primitiveStart  = (1 << 4);
+    }
+
     int getEncodingType(const std::string &str) {
       int encoding      = 0;
       int encodingCount = 0;
@@ -147,6 +157,38 @@ namespace occa {
         operatorCharcodes += (it->first);
         ++it;
       }
+
+      setupCharClasses();
+    }
+
+    void tokenizer_t::setupCharClasses() {
+      ::memset(charClasses, 0, sizeof(charClasses));
+
+      const char *charsets[5] = {
+        charcodes::whitespaceNoNewline,
+        charcodes::identifierStart,
+        charcodes::identifier,
+        operatorCharcodes.c_str(),
+        // Only primitives can start with these and digits,
+        //   see primitive::load
+        ".tf"
+      };
+      const unsigned char classes[5] = {
+        charClass::whitespace,
+        charClass::identifierStart,
+        charClass::identifier,
+        charClass::operatorStart,
+        charClass::primitiveStart
+      };
+      for (int i = 0; i < 5; ++i) {
+        const char *c = charsets[i];
+        while (*c) {
+          charClasses[(unsigned char) *(c++)] |= classes[i];
+        }
+      }
+      for (char c = '0'; c <= '9'; ++c) {
+        charClasses[(unsigned char) c] |= charClass::primitiveStart;
+      }
     }
 
     baseStream<token_t*>& tokenizer_t::clone() const {
@@ -225,6 +267,39 @@ namespace occa {
     }
 
     void tokenizer_t::pushSource(const std::string &filename) {
+      rewindOutputCache();
+
+      // TODO: Use a fileCache
+      file_t *file = new file_t(filename);
+      origin.push(true,
+                  *file,
+                  file->content.c_str());
+    }
+
+    void tokenizer_t::pushTokens(const tokenVector &tokens) {
+      rewindOutputCache();
+
+      // Same output as pushSource, with origins pointing
+      //   back to where the tokens were included
+      fileOrigin *includeOrigin = new fileOrigin(origin);
+      includeOrigin->fromInclude = true;
+      includeOrigin->addRef();
+
+      const int tokenCount = (int) tokens.size();
+      for (int i = 0; i < tokenCount; ++i) {
+        token_t *token = tokens[i]->clone();
+        token->origin.setUp(includeOrigin);
+        outputCache.push_back(token);
+      }
+      // Leaving the source emits a newline
+      outputCache.push_back(new newlineToken(origin));
+
+      if (!includeOrigin->removeRef()) {
+        delete includeOrigin;
+      }
+    }
+
+    void tokenizer_t::rewindOutputCache() {
       // Delete tokens and rewind
       if (outputCache.size()) {
         origin = outputCache.front()->origin;
@@ -235,12 +310,6 @@ namespace occa {
         }
         outputCache.clear();
       }
-
-      // TODO: Use a fileCache
-      file_t *file = new file_t(filename);
-      origin.push(true,
-                  *file,
-                  file->content.c_str());
     }
 
     void tokenizer_t::popSource() {
@@ -387,8 +456,27 @@ namespace occa {
       }
     }
 
+    void tokenizer_t::skipFrom(const unsigned char charClass_) {
+      // None of the classes include newlines
+      while (true) {
+        const char c = *fp.start;
+        if (isCharClass(c, charClass_)) {
+          ++fp.start;
+          continue;
+        }
+        if (c != '\\') {
+          return;
+        }
+        if (fp.start[1] == '\n') {
+          fp.lineStart = fp.start + 2;
+          ++fp.line;
+        }
+        fp.start += 1 + (fp.start[1] != '\0');
+      }
+    }
+
     void tokenizer_t::skipWhitespace() {
-      skipFrom(charcodes::whitespaceNoNewline);
+      skipFrom(charClass::whitespace);
     }
 
     int tokenizer_t::peek() {
@@ -412,14 +500,16 @@ namespace occa {
       //   and operators since:
       //   - true/false
       //   - Operators can start with a . (for example, .01)
-      const char *pos = fp.start;
-      if (primitive::load(pos, false).type != occa::primitiveType::none) {
-        return tokenType::primitive;
+      if (isCharClass(c, charClass::primitiveStart)) {
+        const char *pos = fp.start;
+        if (primitive::load(pos, false).type != occa::primitiveType::none) {
+          return tokenType::primitive;
+        }
       }
-      if (lex::inCharset(c, charcodes::identifierStart)) {
+      if (isCharClass(c, charClass::identifierStart)) {
         return tokenType::identifier;
       }
-      if (lex::inCharset(c, operatorCharcodes.c_str())) {
+      if (isCharClass(c, charClass::operatorStart)) {
         return tokenType::op;
       }
       if (c == '\n') {
@@ -437,26 +527,33 @@ namespace occa {
     int tokenizer_t::peekForIdentifier() {
       push();
       ++fp.start;
-      skipFrom(charcodes::identifier);
-      const std::string identifier = str();
-      int type = shallowPeek();
+      skipFrom(charClass::identifier);
+      // Only builds the identifier string when it could be an encoding
+      const char *identifierStart = stack.back().position.start;
+      const int identifierSize = (int) (fp.start - identifierStart);
+      skipWhitespace();
+      const char nextChar = *fp.start;
       popAndRewind();
 
       // sizeof, new, delete, throw
-      if (operators.has(identifier)) {
+      if (operators.has(identifierStart, identifierSize)) {
         return tokenType::op;
       };
 
       // [u8R]"foo" or [u]'foo'
-      if (type & tokenType::string) {
-        const int encoding = getStringEncoding(identifier);
+      if (nextChar == '"') {
+        const int encoding = getStringEncoding(
+          std::string(identifierStart, identifierSize)
+        );
         if (encoding) {
           return (tokenType::string |
                   (encoding << tokenType::encodingShift));
         }
       }
-      if (type & tokenType::char_) {
-        const int encoding = getCharacterEncoding(identifier);
+      if (nextChar == '\'') {
+        const int encoding = getCharacterEncoding(
+          std::string(identifierStart, identifierSize)
+        );
         if (encoding) {
           return (tokenType::char_ |
                   (encoding << tokenType::encodingShift));
@@ -488,12 +585,12 @@ namespace occa {
     }
 
     void tokenizer_t::getIdentifier(std::string &value) {
-      if (!lex::inCharset(*fp.start, charcodes::identifierStart)) {
+      if (!isCharClass(*fp.start, charClass::identifierStart)) {
         return;
       }
       push();
       ++fp.start;
-      skipFrom(charcodes::identifier);
+      skipFrom(charClass::identifier);
       value = str();
       pop();
     }
@@ -650,7 +747,7 @@ namespace occa {
     }
 
     token_t* tokenizer_t::getIdentifierToken() {
-      if (!lex::inCharset(*fp.start, charcodes::identifierStart)) {
+      if (!isCharClass(*fp.start, charClass::identifierStart)) {
         printError("Not able to parse identifier");
         return NULL;
       }
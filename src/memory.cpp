@@ -27,6 +27,7 @@
 #include <occa/device.hpp>
 #include <occa/mode/serial/memory.hpp>
 #include <occa/uva.hpp>
+#include <occa/tools/profiler.hpp>
 #include <occa/tools/sys.hpp>
 
 namespace occa {
@@ -39,25 +40,19 @@ namespace occa {
     ptr(NULL),
     uvaPtr(NULL),
     modeDevice(modeDevice_),
+    leftStaleEntry(NULL),
+    rightStaleEntry(NULL),
     size(size_),
-    canBeFreed(true) {
+    canBeFreed(true),
+    isPooled(false) {
     modeDevice->addMemoryRef(this);
   }
 
   modeMemory_t::~modeMemory_t() {
-    // NULL all wrappers
-    memory *head = (memory*) memoryRing.head;
-    if (head) {
-      memory *ptr_ = head;
-      do {
-        memory *nextPtr = (memory*) ptr_->rightRingEntry;
-        ptr_->modeMemory = NULL;
-        ptr_->removeRef();
-        ptr_ = nextPtr;
-      } while (ptr_ != head);
-    }
+    removeMemoryRefs();
     // Remove ref from device
     if (modeDevice) {
+      modeDevice->removeStaleMemory(this);
       modeDevice->removeMemoryRef(this);
     }
   }
@@ -82,6 +77,21 @@ namespace occa {
     return memoryRing.needsFree();
   }
 
+  void modeMemory_t::removeMemoryRefs() {
+    // NULL all wrappers
+    memory *head = (memory*) memoryRing.head;
+    if (head) {
+      // Unlink entries after the head until it's the only one left
+      while (!head->isAlone()) {
+        memory *ptr_ = (memory*) head->rightRingEntry;
+        ptr_->modeMemory = NULL;
+        ptr_->removeRef();
+      }
+      head->modeMemory = NULL;
+    }
+    memoryRing.clear();
+  }
+
   bool modeMemory_t::isManaged() const {
     return (memInfo & uvaFlag::isManaged);
   }
@@ -100,9 +110,9 @@ namespace occa {
 
   memory::memory(void *uvaPtr) :
     modeMemory(NULL) {
-    ptrRangeMap::iterator it = uvaMap.find(uvaPtr);
-    if (it != uvaMap.end()) {
-      setModeMemory(it->second);
+    modeMemory_t *modeMemory_ = uvaMap.find(uvaPtr);
+    if (modeMemory_) {
+      setModeMemory(modeMemory_);
     } else {
       setModeMemory((modeMemory_t*) uvaPtr);
     }
@@ -261,12 +271,12 @@ namespace occa {
     range.start = modeMemory->uvaPtr;
     range.end   = (range.start + modeMemory->size);
 
-    uvaMap[range] = modeMemory;
+    uvaMap.insert(range, modeMemory);
     modeMemory->modeDevice->uvaMap[range] = modeMemory;
 
     // Needed for kernelArg.void_ -> modeMemory checks
     if (modeMemory->uvaPtr != modeMemory->ptr) {
-      uvaMap[modeMemory->ptr] = modeMemory;
+      uvaMap.insert(modeMemory->ptr, modeMemory);
     }
   }
 
@@ -305,10 +315,14 @@ namespace occa {
       return;
     }
 
+    profileScope_t profile(profileCategory::sync,
+                           "syncToDevice",
+                           bytes_);
+
     copyFrom(modeMemory->uvaPtr, bytes_, offset);
+    modeMemory->modeDevice->bytesSyncedToDevice += bytes_;
 
-    modeMemory->memInfo |=  uvaFlag::inDevice;
-    modeMemory->memInfo &= ~uvaFlag::isStale;
+    modeMemory->memInfo |= uvaFlag::inDevice;
 
     removeFromStaleMap(modeMemory);
   }
@@ -336,10 +350,14 @@ namespace occa {
       return;
     }
 
+    profileScope_t profile(profileCategory::sync,
+                           "syncToHost",
+                           bytes_);
+
     copyTo(modeMemory->uvaPtr, bytes_, offset);
+    modeMemory->modeDevice->bytesSyncedToHost += bytes_;
 
     modeMemory->memInfo &= ~uvaFlag::inDevice;
-    modeMemory->memInfo &= ~uvaFlag::isStale;
 
     removeFromStaleMap(modeMemory);
   }
@@ -350,13 +368,13 @@ namespace occa {
 
   void memory::uvaMarkStale() {
     if (modeMemory != NULL) {
-      modeMemory->memInfo |= uvaFlag::isStale;
+      modeMemory->modeDevice->addStaleMemory(modeMemory);
     }
   }
 
   void memory::uvaMarkFresh() {
     if (modeMemory != NULL) {
-      modeMemory->memInfo &= ~uvaFlag::isStale;
+      modeMemory->modeDevice->removeStaleMemory(modeMemory);
     }
   }
 
@@ -423,6 +441,17 @@ namespace occa {
                << " trying to access [" << offset << ", " << (offset + bytes_) << "]",
                (bytes_ + offset) <= modeMemory->size);
 
+    graph_t *capturingGraph = modeMemory->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addCopy(*this, NULL, offset,
+                              memory(), src, 0,
+                              bytes_, props);
+      return;
+    }
+
+    profileScope_t profile(profileCategory::copy,
+                           "copyFrom",
+                           bytes_);
     modeMemory->copyFrom(src, bytes_, offset, props);
   }
 
@@ -452,6 +481,17 @@ namespace occa {
                << " trying to access [" << destOffset << ", " << (destOffset + bytes_) << "]",
                (bytes_ + destOffset) <= modeMemory->size);
 
+    graph_t *capturingGraph = modeMemory->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addCopy(*this, NULL, destOffset,
+                              src, NULL, srcOffset,
+                              bytes_, props);
+      return;
+    }
+
+    profileScope_t profile(profileCategory::copy,
+                           "copyFrom",
+                           bytes_);
     modeMemory->copyFrom(src.modeMemory, bytes_, destOffset, srcOffset, props);
   }
 
@@ -473,6 +513,17 @@ namespace occa {
                << " trying to access [" << offset << ", " << (offset + bytes_) << "]",
                (bytes_ + offset) <= modeMemory->size);
 
+    graph_t *capturingGraph = modeMemory->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addCopy(memory(), dest, 0,
+                              *this, NULL, offset,
+                              bytes_, props);
+      return;
+    }
+
+    profileScope_t profile(profileCategory::copy,
+                           "copyTo",
+                           bytes_);
     modeMemory->copyTo(dest, bytes_, offset, props);
   }
 
@@ -502,6 +553,17 @@ namespace occa {
                << " trying to access [" << destOffset << ", " << (destOffset + bytes_) << "]",
                (bytes_ + destOffset) <= dest.modeMemory->size);
 
+    graph_t *capturingGraph = modeMemory->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addCopy(dest, NULL, destOffset,
+                              *this, NULL, srcOffset,
+                              bytes_, props);
+      return;
+    }
+
+    profileScope_t profile(profileCategory::copy,
+                           "copyTo",
+                           bytes_);
     dest.modeMemory->copyFrom(modeMemory, bytes_, destOffset, srcOffset, props);
   }
 
@@ -535,6 +597,9 @@ namespace occa {
   }
 
   void memory::free() {
+    profileScope_t profile(profileCategory::free,
+                           mode(),
+                           size());
     deleteRefs(true);
   }
 
@@ -566,6 +631,18 @@ namespace occa {
         }
       }
 
+      // Keep pooled blocks around for the next allocation
+      if (freeMemory && modeMemory->isPooled) {
+        modeMemory_t *modeMemory_ = modeMemory;
+        modeMemory_->removeMemoryRefs();
+        modeMemory = NULL;
+        // Queued launches may still use the block, so wait for them
+        //   the same way modeMemory_t::free() does before handing it out
+        modeDevice->finish();
+        modeDevice->addPooledMemory(modeMemory_);
+        return;
+      }
+
       if (freeMemory) {
         modeMemory->free();
       } else {
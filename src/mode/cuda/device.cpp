@@ -178,7 +178,8 @@ namespace occa {
                            const std::string &hostOutputFile,
                            const occa::properties &kernelProps,
                            lang::kernelMetadataMap &hostMetadata,
-                           lang::kernelMetadataMap &deviceMetadata) {
+                           lang::kernelMetadataMap &deviceMetadata,
+                           strVector &dependencies) {
       lang::okl::cudaParser parser(kernelProps);
       parser.parseFile(filename);
 
@@ -208,6 +209,7 @@ namespace occa {
 
       parser.hostParser.setMetadata(hostMetadata);
       parser.setMetadata(deviceMetadata);
+      parser.setDependencies(dependencies);
 
       return true;
     }
@@ -270,6 +272,7 @@ namespace occa {
 
       modeKernel_t *launcherKernel = NULL;
       lang::kernelMetadataMap hostMetadata, deviceMetadata;
+      strVector dependencies;
       if (usingOKL) {
         const std::string outputFile = hashDir + kc::sourceFile;
         const std::string hostOutputFile = hashDir + kc::hostSourceFile;
@@ -278,7 +281,8 @@ namespace occa {
                                hostOutputFile,
                                kernelProps,
                                hostMetadata,
-                               deviceMetadata);
+                               deviceMetadata,
+                               dependencies);
         if (!valid) {
           return NULL;
         }
@@ -300,7 +304,8 @@ namespace occa {
         writeKernelBuildFile(hashDir + kc::buildFile,
                              kernelHash,
                              kernelProps,
-                             deviceMetadata);
+                             deviceMetadata,
+                             dependencies);
       }
 
       compileKernel(hashDir,
@@ -368,65 +373,85 @@ namespace occa {
 
       setArchCompilerFlags(allProps);
 
-      //---[ PTX Check Command ]--------
-      std::stringstream command;
-      if (allProps.has("compiler_env_script")) {
-        command << allProps["compiler_env_script"] << " && ";
-      }
+      const std::string compiler = allProps["compiler"];
+      const std::string compilerFlags = allProps["compiler_flags"];
+      const std::string compilerEnvScript = allProps.get<std::string>("compiler_env_script");
+      const double compilerTimeout = allProps.get("compiler_timeout", -1.0);
 
-      command << allProps["compiler"]
-              << ' ' << allProps["compiler_flags"]
-              << " -Xptxas -v,-dlcm=cg"
+      strVector commonArgs;
 #if (OCCA_OS == OCCA_WINDOWS_OS)
-              << " -D OCCA_OS=OCCA_WINDOWS_OS -D _MSC_VER=1800"
+      commonArgs.push_back("-D");
+      commonArgs.push_back("OCCA_OS=OCCA_WINDOWS_OS");
+      commonArgs.push_back("-D");
+      commonArgs.push_back("_MSC_VER=1800");
 #endif
-              << " -I"        << env::OCCA_DIR << "include"
-              << " -L"        << env::OCCA_DIR << "lib -locca"
-              << " -x cu -c " << sourceFilename
-              << " -o "       << ptxBinaryFilename;
+      commonArgs.push_back("-I" + env::OCCA_DIR + "include");
+      commonArgs.push_back("-L" + env::OCCA_DIR + "lib");
+      commonArgs.push_back("-locca");
+      commonArgs.push_back("-x");
+      commonArgs.push_back("cu");
 
-      if (!verbose) {
-        command << " > /dev/null 2>&1";
-      }
-      const std::string &ptxCommand = command.str();
+      //---[ PTX Check Command ]--------
+      strVector args;
+      args.push_back("-Xptxas");
+      args.push_back("-v,-dlcm=cg");
+      args.insert(args.end(), commonArgs.begin(), commonArgs.end());
+      args.push_back("-c");
+      args.push_back(sourceFilename);
+      args.push_back("-o");
+      args.push_back(ptxBinaryFilename);
+
+      strVector command = sys::compilerCommand(compiler,
+                                               compilerFlags,
+                                               compilerEnvScript,
+                                               args);
+      const std::string ptxCommand = sys::joinCommand(command);
       if (verbose) {
         std::cout << "Compiling [" << kernelName << "]\n" << ptxCommand << "\n";
       }
 
-#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-      ignoreResult( system(ptxCommand.c_str()) );
-#else
-      ignoreResult( system(("\"" +  ptxCommand + "\"").c_str()) );
-#endif
+      // Only used for the register and memory usage report
+      std::string ptxOutput;
+      sys::runProcess(command, ptxOutput, compilerTimeout);
+      if (verbose) {
+        std::cout << ptxOutput;
+      }
       //================================
 
       //---[ Compiling Command ]--------
-      command.str("");
-      command << allProps["compiler"]
-              << ' ' << allProps["compiler_flags"]
-              << " -ptx"
-#if (OCCA_OS == OCCA_WINDOWS_OS)
-              << " -D OCCA_OS=OCCA_WINDOWS_OS -D _MSC_VER=1800"
-#endif
-              << " -I"        << env::OCCA_DIR << "include"
-              << " -L"        << env::OCCA_DIR << "lib -locca"
-              << " -x cu " << sourceFilename
-              << " -o "    << binaryFilename;
-
-      if (!verbose) {
-        command << " > /dev/null 2>&1";
-      }
-      const std::string &sCommand = command.str();
+      args.clear();
+      args.push_back("-ptx");
+      args.insert(args.end(), commonArgs.begin(), commonArgs.end());
+      args.push_back(sourceFilename);
+      args.push_back("-o");
+      args.push_back(binaryFilename);
+
+      command = sys::compilerCommand(compiler,
+                                     compilerFlags,
+                                     compilerEnvScript,
+                                     args);
+      const std::string sCommand = sys::joinCommand(command);
       if (verbose) {
         std::cout << sCommand << '\n';
       }
 
-      const int compileError = system(sCommand.c_str());
+      std::string compilerOutput;
+      const int compileError = sys::runProcess(command,
+                                               compilerOutput,
+                                               compilerTimeout);
+      if (verbose) {
+        std::cout << compilerOutput;
+      }
+
+      io::write(hashDir + kc::buildLogFile,
+                ptxCommand + "\n" + ptxOutput
+                + sCommand + "\n" + compilerOutput);
 
       lock.release();
       if (compileError) {
         OCCA_FORCE_ERROR("Error compiling [" << kernelName << "],"
-                         " Command: [" << sCommand << ']');
+                         " Command: [" << sCommand << "]\n"
+                         << compilerOutput);
       }
       //================================
     }
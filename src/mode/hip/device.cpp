@@ -184,7 +184,8 @@ namespace occa {
                            const std::string &hostOutputFile,
                            const occa::properties &kernelProps,
                            lang::kernelMetadataMap &hostMetadata,
-                           lang::kernelMetadataMap &deviceMetadata) {
+                           lang::kernelMetadataMap &deviceMetadata,
+                           strVector &dependencies) {
       lang::okl::hipParser parser(kernelProps);
       parser.parseFile(filename);
 
@@ -214,6 +215,7 @@ namespace occa {
 
       parser.hostParser.setMetadata(hostMetadata);
       parser.setMetadata(deviceMetadata);
+      parser.setDependencies(dependencies);
 
       return true;
     }
@@ -276,6 +278,7 @@ namespace occa {
 
       modeKernel_t *launcherKernel = NULL;
       lang::kernelMetadataMap hostMetadata, deviceMetadata;
+      strVector dependencies;
       if (usingOKL) {
         const std::string outputFile = hashDir + kc::sourceFile;
         const std::string hostOutputFile = hashDir + kc::hostSourceFile;
@@ -284,7 +287,8 @@ namespace occa {
                                hostOutputFile,
                                kernelProps,
                                hostMetadata,
-                               deviceMetadata);
+                               deviceMetadata,
+                               dependencies);
         if (!valid) {
           return NULL;
         }
@@ -306,7 +310,8 @@ namespace occa {
         writeKernelBuildFile(hashDir + kc::buildFile,
                              kernelHash,
                              kernelProps,
-                             deviceMetadata);
+                             deviceMetadata,
+                             dependencies);
       }
 
       compileKernel(hashDir,
@@ -374,34 +379,47 @@ namespace occa {
 
       setArchCompilerFlags(kernelProps);
 
-      std::stringstream command;
-
       //---[ Compiling Command ]--------
-      command.str("");
-      command << kernelProps["compiler"]
-              << " --genco "
-              << " "       << sourceFilename
-              << " -o "    << binaryFilename
-              << ' ' << kernelProps["compiler_flags"]
+      strVector args;
+      args.push_back("--genco");
+      args.push_back(sourceFilename);
+      args.push_back("-o");
+      args.push_back(binaryFilename);
+
+      const strVector compilerFlags = sys::expandCommand(kernelProps["compiler_flags"]);
+      args.insert(args.end(), compilerFlags.begin(), compilerFlags.end());
 #if (OCCA_OS == OCCA_WINDOWS_OS)
-              << " -D OCCA_OS=OCCA_WINDOWS_OS -D _MSC_VER=1800"
+      args.push_back("-D");
+      args.push_back("OCCA_OS=OCCA_WINDOWS_OS");
+      args.push_back("-D");
+      args.push_back("_MSC_VER=1800");
 #endif
-        ;
 
-      if (!verbose) {
-        command << " > /dev/null 2>&1";
-      }
-      const std::string &sCommand = command.str();
+      const strVector command = sys::compilerCommand(kernelProps["compiler"],
+                                                     "",
+                                                     kernelProps.get<std::string>("compiler_env_script"),
+                                                     args);
+      const std::string sCommand = sys::joinCommand(command);
       if (verbose) {
         std::cout << sCommand << '\n';
       }
 
-      const int compileError = system(sCommand.c_str());
+      std::string compilerOutput;
+      const int compileError = sys::runProcess(command,
+                                               compilerOutput,
+                                               kernelProps.get("compiler_timeout", -1.0));
+      if (verbose) {
+        std::cout << compilerOutput;
+      }
+
+      io::write(hashDir + kc::buildLogFile,
+                sCommand + "\n" + compilerOutput);
 
       lock.release();
       if (compileError) {
         OCCA_FORCE_ERROR("Error compiling [" << kernelName << "],"
-                         " Command: [" << sCommand << ']');
+                         " Command: [" << sCommand << "]\n"
+                         << compilerOutput);
       }
       //================================
     }
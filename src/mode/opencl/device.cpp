@@ -185,7 +185,8 @@ namespace occa {
                            const std::string &hostOutputFile,
                            const occa::properties &kernelProps,
                            lang::kernelMetadataMap &hostMetadata,
-                           lang::kernelMetadataMap &deviceMetadata) {
+                           lang::kernelMetadataMap &deviceMetadata,
+                           strVector &dependencies) {
       lang::okl::openclParser parser(kernelProps);
       parser.parseFile(filename);
 
@@ -215,6 +216,7 @@ namespace occa {
 
       parser.hostParser.setMetadata(hostMetadata);
       parser.setMetadata(deviceMetadata);
+      parser.setDependencies(dependencies);
 
       return true;
     }
@@ -282,6 +284,7 @@ namespace occa {
 
       modeKernel_t *launcherKernel = NULL;
       lang::kernelMetadataMap hostMetadata, deviceMetadata;
+      strVector dependencies;
       if (usingOKL) {
         const std::string outputFile = hashDir + kc::sourceFile;
         const std::string hostOutputFile = hashDir + kc::hostSourceFile;
@@ -290,7 +293,8 @@ namespace occa {
                                hostOutputFile,
                                kernelProps,
                                hostMetadata,
-                               deviceMetadata);
+                               deviceMetadata,
+                               dependencies);
         if (!valid) {
           return NULL;
         }
@@ -312,7 +316,8 @@ namespace occa {
         writeKernelBuildFile(hashDir + kc::buildFile,
                              kernelHash,
                              kernelProps,
-                             deviceMetadata);
+                             deviceMetadata,
+                             dependencies);
       }
 
       // Build OpenCL program
@@ -358,7 +363,7 @@ namespace occa {
                                                    lang::kernelMetadataMap &hostMetadata,
                                                    lang::kernelMetadataMap &deviceMetadata,
                                                    const occa::properties &kernelProps,
-                                                   io::lock_t lock) {
+                                                   io::lock_t &lock) {
 
       const std::string sourceFilename = hashDir + kc::sourceFile;
       const std::string binaryFilename = hashDir + kc::binaryFile;
@@ -51,7 +51,8 @@ namespace occa {
     bool device::parseFile(const std::string &filename,
                            const std::string &outputFile,
                            const occa::properties &kernelProps,
-                           lang::kernelMetadataMap &metadata) {
+                           lang::kernelMetadataMap &metadata,
+                           strVector &dependencies) {
       lang::okl::openmpParser parser(kernelProps);
       parser.parseFile(filename);
 
@@ -72,6 +73,7 @@ namespace occa {
       }
 
       parser.setMetadata(metadata);
+      parser.setDependencies(dependencies);
 
       return true;
     }
@@ -90,6 +92,8 @@ namespace occa {
         vendor = sys::compilerVendor(compiler);
       }
 
+      // Kernels can be built from buildKernelAsync threads
+      kernelMutex.lock();
       if (compiler != lastCompiler) {
         lastCompiler = compiler;
         lastCompilerOpenMPFlag = openmp::compilerFlag(vendor, compiler);
@@ -99,10 +103,12 @@ namespace occa {
                     << "] does not support OpenMP, defaulting to [Serial] mode\n";
         }
       }
+      const std::string openmpFlag = lastCompilerOpenMPFlag;
+      kernelMutex.unlock();
 
-      const bool usingOpenMP = (lastCompilerOpenMPFlag != openmp::notSupported);
+      const bool usingOpenMP = (openmpFlag != openmp::notSupported);
       if (usingOpenMP) {
-        allKernelProps["compiler_flags"] += " " + lastCompilerOpenMPFlag;
+        allKernelProps["compiler_flags"] += " " + openmpFlag;
       }
 
       modeKernel_t *k = serial::device::buildKernel(filename,
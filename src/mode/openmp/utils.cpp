@@ -76,14 +76,15 @@ namespace occa {
       if (lock.isMine()
           && !io::isFile(outFilename)) {
         std::string flag = baseCompilerFlag(vendor_);
-        ss << compiler
-           << ' '    << flag
-           << ' '    << srcFilename
-           << " -o " << binaryFilename
-           << " > /dev/null 2>&1";
-
-        const std::string compileLine = ss.str();
-        const int compileError = system(compileLine.c_str());
+        strVector args;
+        args.push_back(srcFilename);
+        args.push_back("-o");
+        args.push_back(binaryFilename);
+
+        const strVector command = sys::compilerCommand(compiler, flag, "", args);
+        std::string buildLog = sys::joinCommand(command) + "\n";
+        const int compileError = sys::runProcess(command, buildLog);
+        io::write(io::dirname(srcFilename) + kc::buildLogFile, buildLog);
 
         if (compileError) {
           flag = openmp::notSupported;
@@ -20,8 +20,11 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 
+#include <cfloat>
+
 #include <occa/base.hpp>
 #include <occa/tools/env.hpp>
+#include <occa/tools/profiler.hpp>
 #include <occa/io.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/mode/serial/device.hpp>
@@ -32,7 +35,9 @@
 namespace occa {
   namespace serial {
     device::device(const occa::properties &properties_) :
-      occa::modeDevice_t(properties_) {
+      occa::modeDevice_t(properties_),
+      nextTag(0),
+      lastTagTime(0) {
 
       int vendor;
       std::string compiler, compilerFlags, compilerEnvScript;
@@ -110,9 +115,22 @@ namespace occa {
 
     device::~device() {}
 
-    void device::free() {}
+    void device::free() {
+      const int tagCount = (int) tags.size();
+      for (int i = 0; i < tagCount; ++i) {
+        delete tags[i];
+      }
+      tags.clear();
+      nextTag = 0;
+      tagCondition.free();
+    }
 
-    void device::finish() const {}
+    void device::finish() const {
+      const int streamCount = (int) streams.size();
+      for (int i = 0; i < streamCount; ++i) {
+        ((stream*) streams[i])->finish();
+      }
+    }
 
     bool device::hasSeparateMemorySpace() const {
       return false;
@@ -136,22 +154,100 @@ namespace occa {
 
     //---[ Stream ]---------------------
     stream_t device::createStream() const {
-      return NULL;
+      return new stream();
     }
 
-    void device::freeStream(stream_t s) const {}
+    void device::freeStream(stream_t s) const {
+      stream *modeStream = (stream*) s;
+      if (modeStream) {
+        modeStream->free();
+        delete modeStream;
+      }
+    }
 
     streamTag device::tagStream() const {
       streamTag ret;
       ret.tagTime = sys::currentTime();
+
+      // Nothing is queued, the current time is already past all work
+      stream *modeStream = (stream*) currentStream;
+      if (!modeStream || modeStream->isIdle()) {
+        return ret;
+      }
+
+      // Queued times identify the tag, keep them unique
+      if (ret.tagTime <= lastTagTime) {
+        ret.tagTime = lastTagTime + (lastTagTime * DBL_EPSILON);
+      }
+      lastTagTime = ret.tagTime;
+
+      // Keep the last [maxTags] tags around for timeBetween and reuse
+      //   the oldest finished one after that
+      const int maxTags = 1024;
+      tag_t *tag = NULL;
+      if ((int) tags.size() >= maxTags) {
+        tagCondition.lock();
+        const int tagCount = (int) tags.size();
+        for (int i = 0; i < tagCount; ++i) {
+          tag_t *oldTag = tags[(nextTag + i) % tagCount];
+          if (oldTag->done) {
+            tag = oldTag;
+            nextTag = (nextTag + i + 1) % tagCount;
+            break;
+          }
+        }
+        tagCondition.unlock();
+      }
+      if (!tag) {
+        tag = new tag_t();
+        tags.push_back(tag);
+      }
+      tag->queuedTime = ret.tagTime;
+      tag->tagTime = 0;
+      tag->done = false;
+      modeStream->enqueue(new tagOp_t(*tag, tagCondition));
+
+      ret.modeTag = tag;
       return ret;
     }
 
-    void device::waitFor(streamTag tag) const {}
+    tag_t* device::getTag(const streamTag &tag) const {
+      tag_t *modeTag = (tag_t*) tag.modeTag;
+      // Recycled tags were already done
+      if (!modeTag ||
+          (modeTag->queuedTime != tag.tagTime)) {
+        return NULL;
+      }
+      return modeTag;
+    }
+
+    void device::waitFor(streamTag tag) const {
+      tag_t *modeTag = getTag(tag);
+      if (!modeTag) {
+        return;
+      }
+      tagCondition.lock();
+      while (!modeTag->done) {
+        tagCondition.wait();
+      }
+      tagCondition.unlock();
+    }
 
     double device::timeBetween(const streamTag &startTag,
                                const streamTag &endTag) const {
-      return (endTag.tagTime - startTag.tagTime);
+      waitFor(startTag);
+      waitFor(endTag);
+
+      // Tags recycled before being timed fall back to when they were queued
+      const tag_t *startModeTag = getTag(startTag);
+      const tag_t *endModeTag = getTag(endTag);
+      const double startTime = (startModeTag
+                                ? startModeTag->tagTime
+                                : startTag.tagTime);
+      const double endTime = (endModeTag
+                              ? endModeTag->tagTime
+                              : endTag.tagTime);
+      return (endTime - startTime);
     }
     //==================================
 
@@ -159,7 +255,8 @@ namespace occa {
     bool device::parseFile(const std::string &filename,
                            const std::string &outputFile,
                            const occa::properties &kernelProps,
-                           lang::kernelMetadataMap &metadata) {
+                           lang::kernelMetadataMap &metadata,
+                           strVector &dependencies) {
       lang::okl::serialParser parser(kernelProps);
       parser.parseFile(filename);
 
@@ -179,6 +276,7 @@ namespace occa {
       }
 
       parser.setMetadata(metadata);
+      parser.setDependencies(dependencies);
 
       return true;
     }
@@ -220,6 +318,9 @@ namespace occa {
                                                 kernelProps);
         if (k) {
           k->sourceFilename = filename;
+          k->metadata = (
+            lang::getBuildFileMetadata(hashDir + kc::buildFile)[kernelName]
+          );
         }
         return k;
       }
@@ -233,12 +334,19 @@ namespace occa {
       );
 
       lang::kernelMetadataMap metadata;
+      strVector dependencies;
+      double parseTime = 0;
       if (kernelProps.get("okl", true)) {
         const std::string outputFile = hashDir + kc::sourceFile;
+        const double parseStart = sys::currentTime();
         bool valid = parseFile(sourceFilename,
                                outputFile,
                                kernelProps,
-                               metadata);
+                               metadata,
+                               dependencies);
+        parseTime = sys::currentTime() - parseStart;
+        profiler.record(profileCategory::parse, kernelName,
+                        parseStart, parseStart + parseTime);
         if (!valid) {
           return NULL;
         }
@@ -247,53 +355,65 @@ namespace occa {
         writeKernelBuildFile(hashDir + kc::buildFile,
                              kernelHash,
                              kernelProps,
-                             metadata);
-      }
-
-      std::stringstream command;
-      std::string compilerEnvScript = kernelProps["compiler_env_script"];
-      if (compilerEnvScript.size()) {
-        command << compilerEnvScript << " && ";
+                             metadata,
+                             dependencies);
       }
 
+      strVector args;
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-      command << (std::string) kernelProps["compiler"]
-              << ' '    << (std::string) kernelProps["compiler_flags"]
-              << ' '    << sourceFilename
-              << " -o " << binaryFilename
-              << " -I"  << env::OCCA_DIR << "include"
-              << " -L"  << env::OCCA_DIR << "lib -locca"
-              << std::endl;
+      args.push_back(sourceFilename);
+      args.push_back("-o");
+      args.push_back(binaryFilename);
+      args.push_back("-I" + env::OCCA_DIR + "include");
+      args.push_back("-L" + env::OCCA_DIR + "lib");
+      args.push_back("-locca");
 #else
-      command << kernelProps["compiler"]
-              << " /D MC_CL_EXE"
-              << " /D OCCA_OS=OCCA_WINDOWS_OS"
-              << " /EHsc"
-              << " /wd4244 /wd4800 /wd4804 /wd4018"
-              << ' '       << kernelProps["compiler_flags"]
-              << " /I"     << env::OCCA_DIR << "include"
-              << ' '       << sourceFilename
-              << " /link " << env::OCCA_DIR << "lib/libocca.lib",
-              << " /OUT:"  << binaryFilename
-              << std::endl;
+      args.push_back("/D");
+      args.push_back("MC_CL_EXE");
+      args.push_back("/D");
+      args.push_back("OCCA_OS=OCCA_WINDOWS_OS");
+      args.push_back("/EHsc");
+      args.push_back("/wd4244");
+      args.push_back("/wd4800");
+      args.push_back("/wd4804");
+      args.push_back("/wd4018");
+      args.push_back("/I" + env::OCCA_DIR + "include");
+      args.push_back(sourceFilename);
+      args.push_back("/link");
+      args.push_back(env::OCCA_DIR + "lib/libocca.lib");
+      args.push_back("/OUT:" + binaryFilename);
 #endif
 
-      const std::string &sCommand = command.str();
+      const strVector command = sys::compilerCommand(kernelProps["compiler"],
+                                                     kernelProps["compiler_flags"],
+                                                     kernelProps["compiler_env_script"],
+                                                     args);
+      const std::string sCommand = sys::joinCommand(command);
 
       if (verbose) {
         std::cout << "Compiling [" << kernelName << "]\n" << sCommand << "\n";
       }
 
-#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-      const int compileError = system(sCommand.c_str());
-#else
-      const int compileError = system(("\"" +  sCommand + "\"").c_str());
-#endif
+      std::string compilerOutput;
+      const double compileStart = sys::currentTime();
+      const int compileError = sys::runProcess(command,
+                                               compilerOutput,
+                                               kernelProps.get("compiler_timeout", -1.0));
+      const double compileTime = sys::currentTime() - compileStart;
+      profiler.record(profileCategory::compile, kernelName,
+                      compileStart, compileStart + compileTime);
+
+      io::write(hashDir + kc::buildLogFile,
+                sCommand + "\n" + compilerOutput);
+      if (verbose && compilerOutput.size()) {
+        std::cout << compilerOutput;
+      }
 
       lock.release();
       if (compileError) {
         OCCA_FORCE_ERROR("Error compiling [" << kernelName << "],"
-                         " Command: [" << sCommand << ']');
+                         " Command: [" << sCommand << "]\n"
+                         << compilerOutput);
       }
 
       modeKernel_t *k = buildKernelFromBinary(binaryFilename,
@@ -301,6 +421,11 @@ namespace occa {
                                               kernelProps);
       if (k) {
         k->sourceFilename = filename;
+        k->metadata = metadata[kernelName];
+        // Only set for kernels built in this call, not cached binaries
+        k->properties["build/parse_time"]   = parseTime;
+        k->properties["build/compile_time"] = compileTime;
+        k->properties["build/compiler_output"] = compilerOutput;
       }
       return k;
     }
@@ -315,8 +440,15 @@ namespace occa {
 
       k.binaryFilename = filename;
 
+      profileScope_t profile(profileCategory::load,
+                             kernelName);
+
       k.dlHandle = sys::dlopen(filename);
       k.function = sys::dlsym(k.dlHandle, kernelName);
+      k.trampoline = (trampolinePtr_t) (
+        sys::dlsymIfExists(k.dlHandle,
+                           lang::okl::serialParser::trampolinePrefix + kernelName)
+      );
 
       return &k;
     }
@@ -24,6 +24,7 @@
 #include <occa/tools/env.hpp>
 #include <occa/io.hpp>
 #include <occa/mode/serial/kernel.hpp>
+#include <occa/mode/serial/stream.hpp>
 #include <occa/lang/mode/serial.hpp>
 
 namespace occa {
@@ -35,9 +36,12 @@ namespace occa {
       occa::modeKernel_t(modeDevice_, name_, sourceFilename_, properties_) {
       dlHandle = NULL;
       function = NULL;
+      trampoline = NULL;
     }
 
-    kernel::~kernel() {}
+    kernel::~kernel() {
+      launchOpMutex.free();
+    }
 
     int kernel::maxDims() const {
       return 3;
@@ -51,11 +55,10 @@ namespace occa {
       return dim(-1,-1,-1);
     }
 
-    void kernel::run() const {
-      const int totalArgCount = kernelArg::argumentCount(arguments);
-      if (!totalArgCount) {
-        vArgs.resize(1);
-      } else if ((int) vArgs.size() < totalArgCount) {
+    int kernel::setupArgs() const {
+      // Leave room for a trailing hidden argument
+      const int totalArgCount = kernelArg::argumentCount(arguments) + 1;
+      if ((int) vArgs.size() < totalArgCount) {
         vArgs.resize(totalArgCount);
       }
 
@@ -72,15 +75,73 @@ namespace occa {
           vArgs[argc++] = iArgs[ai].ptr();
         }
       }
+      return argc;
+    }
+
+    launchOp_t* kernel::getLaunchOp() const {
+      launchOpMutex.lock();
+      launchOp_t *op = NULL;
+      if (launchOps.size()) {
+        op = launchOps.back();
+        launchOps.pop_back();
+      }
+      launchOpMutex.unlock();
+
+      if (!op) {
+        op = new launchOp_t(*this);
+      }
+      return op;
+    }
+
+    void kernel::releaseLaunchOp(launchOp_t *op) const {
+      // Don't hold on to every op from a deep queue
+      const int maxLaunchOps = 64;
+      launchOpMutex.lock();
+      if ((int) launchOps.size() < maxLaunchOps) {
+        launchOps.push_back(op);
+        op = NULL;
+      }
+      launchOpMutex.unlock();
+      delete op;
+    }
+
+    void kernel::run() const {
+      stream *modeStream = (stream*) modeDevice->currentStream;
+      if (modeStream) {
+        launchOp_t *op = getLaunchOp();
+        op->setup(arguments);
+        modeStream->enqueue(op);
+        return;
+      }
+
+      const int argc = setupArgs();
+      launch(argc, &(vArgs[0]));
+    }
 
-      sys::runFunction(function, argc, &(vArgs[0]));
+    void kernel::launch(const int argc,
+                        void **args) const {
+      if (trampoline) {
+        trampoline(args);
+      } else {
+        sys::runFunction(function, argc, args);
+      }
     }
 
     void kernel::free() {
+      // Queued launches may still use the library
+      if (modeDevice) {
+        modeDevice->finish();
+      }
       if (dlHandle) {
         sys::dlclose(dlHandle);
         dlHandle = NULL;
       }
+
+      const int opCount = (int) launchOps.size();
+      for (int i = 0; i < opCount; ++i) {
+        delete launchOps[i];
+      }
+      launchOps.clear();
     }
   }
 }
@@ -21,6 +21,7 @@
  */
 
 #include <occa/mode/serial/memory.hpp>
+#include <occa/mode/serial/stream.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/device.hpp>
 
@@ -61,7 +62,7 @@ namespace occa {
                         const occa::properties &props) const {
       const void *srcPtr = ptr + offset;
 
-      ::memcpy(dest, srcPtr, bytes);
+      copy(dest, srcPtr, bytes, props);
     }
 
     void memory::copyFrom(const void *src,
@@ -72,7 +73,7 @@ namespace occa {
       void *destPtr      = ptr + offset;
       const void *srcPtr = src;
 
-      ::memcpy(destPtr, srcPtr, bytes);
+      copy(destPtr, srcPtr, bytes, props);
     }
 
     void memory::copyFrom(const modeMemory_t *src,
@@ -84,11 +85,29 @@ namespace occa {
       void *destPtr      = ptr + destOffset;
       const void *srcPtr = src->ptr + srcOffset;
 
-      ::memcpy(destPtr, srcPtr, bytes);
+      copy(destPtr, srcPtr, bytes, props);
+    }
+
+    void memory::copy(void *dest,
+                      const void *src,
+                      const udim_t bytes,
+                      const occa::properties &props) const {
+      stream *modeStream = (stream*) modeDevice->currentStream;
+      if (modeStream && props.get("async", false)) {
+        modeStream->enqueue(new memcpyOp_t(dest, src, bytes));
+        return;
+      }
+      // Blocking copies wait for queued kernels and copies
+      modeDevice->finish();
+      ::memcpy(dest, src, bytes);
     }
 
     void memory::free() {
       if (ptr) {
+        // Queued work may still use the buffer
+        if (modeDevice) {
+          modeDevice->finish();
+        }
         sys::free(ptr);
         ptr = NULL;
         size = 0;
@@ -0,0 +1,207 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#include <cstring>
+
+#include <occa/mode/serial/stream.hpp>
+#include <occa/mode/serial/kernel.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace serial {
+    //---[ Stream Ops ]-----------------
+    streamOp_t::~streamOp_t() {}
+
+    void streamOp_t::release() {
+      delete this;
+    }
+
+    launchOp_t::launchOp_t(const kernel &launchedKernel_) :
+      launchedKernel(launchedKernel_),
+      argc(0) {}
+
+    void launchOp_t::setup(const std::vector<kernelArg> &arguments) {
+      // Reuse the storage from previous launches
+      args.clear();
+
+      const int kArgCount = (int) arguments.size();
+      for (int i = 0; i < kArgCount; ++i) {
+        const kArgVector &iArgs = arguments[i].args;
+        args.insert(args.end(), iArgs.begin(), iArgs.end());
+      }
+      argc = (int) args.size();
+
+      // Arguments passed by value are copied since the caller may not
+      //   outlive the launch
+      size_t valueBytes = 0;
+      for (int i = 0; i < argc; ++i) {
+        if (args[i].info & kArgInfo::isValue) {
+          valueBytes += args[i].size;
+        }
+      }
+      if (valueBytes) {
+        if (values.size() < valueBytes) {
+          values.resize(valueBytes);
+        }
+        char *value = &(values[0]);
+        for (int i = 0; i < argc; ++i) {
+          kernelArgData &arg = args[i];
+          if (arg.info & kArgInfo::isValue) {
+            ::memcpy(value, arg.data.void_, arg.size);
+            arg.data.void_ = value;
+            value += arg.size;
+          }
+        }
+      }
+
+      // Leave room for a trailing hidden argument
+      if ((int) vArgs.size() < (argc + 1)) {
+        vArgs.resize(argc + 1);
+      }
+      for (int i = 0; i < argc; ++i) {
+        vArgs[i] = args[i].ptr();
+      }
+    }
+
+    void launchOp_t::run() {
+      launchedKernel.launch(argc, &(vArgs[0]));
+    }
+
+    void launchOp_t::release() {
+      launchedKernel.releaseLaunchOp(this);
+    }
+
+    memcpyOp_t::memcpyOp_t(void *dest_,
+                           const void *src_,
+                           const udim_t bytes_) :
+      dest(dest_),
+      src(src_),
+      bytes(bytes_) {}
+
+    void memcpyOp_t::run() {
+      ::memcpy(dest, src, bytes);
+    }
+
+    tag_t::tag_t() :
+      queuedTime(0),
+      tagTime(0),
+      done(false) {}
+
+    tagOp_t::tagOp_t(tag_t &tag_,
+                     condition &tagCondition_) :
+      tag(tag_),
+      tagCondition(tagCondition_) {}
+
+    void tagOp_t::run() {
+      tagCondition.lock();
+      tag.tagTime = sys::currentTime();
+      tag.done = true;
+      tagCondition.broadcast();
+      tagCondition.unlock();
+    }
+    //==================================
+
+    //---[ Stream ]---------------------
+    stream::stream() :
+      busy(false),
+      stopping(false) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_create(&tid, NULL, serial::streamLoop, this);
+#else
+      tid = CreateThread(NULL, 0,
+                         (LPTHREAD_START_ROUTINE) serial::streamLoop,
+                         this, 0, NULL);
+#endif
+    }
+
+    void stream::free() {
+      queueCondition.lock();
+      stopping = true;
+      queueCondition.broadcast();
+      queueCondition.unlock();
+
+      // The worker drains queued ops before stopping
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_join(tid, NULL);
+#else
+      WaitForSingleObject(tid, INFINITE);
+      CloseHandle(tid);
+#endif
+
+      queueCondition.free();
+    }
+
+    void stream::enqueue(streamOp_t *op) {
+      queueCondition.lock();
+      ops.push_back(op);
+      queueCondition.broadcast();
+      queueCondition.unlock();
+    }
+
+    void stream::finish() {
+      queueCondition.lock();
+      while (busy || !ops.empty()) {
+        queueCondition.wait();
+      }
+      queueCondition.unlock();
+    }
+
+    bool stream::isIdle() {
+      queueCondition.lock();
+      const bool idle = (!busy && ops.empty());
+      queueCondition.unlock();
+      return idle;
+    }
+
+    void* streamLoop(void *args) {
+      stream &s = *((stream*) args);
+
+      s.queueCondition.lock();
+      while (true) {
+        while (s.ops.empty() && !s.stopping) {
+          s.queueCondition.wait();
+        }
+        if (s.ops.empty()) {
+          break;
+        }
+
+        streamOp_t *op = s.ops.front();
+        s.ops.pop_front();
+        s.busy = true;
+        s.queueCondition.unlock();
+
+        op->run();
+        op->release();
+
+        s.queueCondition.lock();
+        s.busy = false;
+        if (s.ops.empty()) {
+          s.queueCondition.broadcast();
+        }
+      }
+      s.queueCondition.unlock();
+
+      return NULL;
+    }
+    //==================================
+  }
+}
@@ -20,11 +20,11 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 
-#if 0
 #include <occa/mode/threads/device.hpp>
 #include <occa/mode/threads/kernel.hpp>
-#include <occa/mode/serial/memory.hpp>
 #include <occa/mode/threads/utils.hpp>
+#include <occa/lang/mode/threads.hpp>
+#include <occa/io.hpp>
 #include <occa/base.hpp>
 
 namespace occa {
@@ -36,6 +36,9 @@ namespace occa {
       std::vector<int> pinnedCores;
 
       threads = properties.get("threads", coreCount);
+      if (threads < 1) {
+        threads = 1;
+      }
 
       if (properties.get<std::string>("schedule", "compact") == "compact") {
         schedule = compact;
@@ -54,7 +57,7 @@ namespace occa {
 
         for (size_t i = 0; i < pinnedCores.size(); ++i)
           if (pinnedCores[i] < 0) {
-            const int newPC = ((pinnedCores[i] % coreCount) + coreCount);
+            const int newPC = (((pinnedCores[i] % coreCount) + coreCount) % coreCount);
 
             std::cout << "Trying to pin thread on core ["
                       << pinnedCores[i] << "], changing it to ["
@@ -72,81 +75,95 @@ namespace occa {
           }
 
         schedule = manual;
+      } else {
+        for (int t = 0; t < threads; ++t) {
+          // [-] Need to know number of sockets
+          if ((schedule == scatter) && (threads < coreCount)) {
+            // Spread threads evenly across the cores
+            pinnedCores.push_back((t * coreCount) / threads);
+          } else {
+            pinnedCores.push_back(t % coreCount);
+          }
+        }
       }
 
-      for (int t = 0; t < threads; ++t) {
-        workerData_t *args = new workerData_t;
+      properties["threads"]  = threads;
+      properties["schedule"] = toString(schedule);
 
-        args->rank  = t;
-        args->count = threads;
+      pool.start(pinnedCores,
+                 properties.get("chunksPerThread", 4));
+    }
 
-        // [-] Need to know number of sockets
-        if (schedule & compact) {
-          args->pinnedCore = (t % coreCount);
-        } else if (schedule & scatter) {
-          args->pinnedCore = (t % coreCount);
-        } else {
-          args->pinnedCore = pinnedCores[t];
-        }
+    device::~device() {
+      pool.stop();
+    }
 
-        args->jobs = &(jobs[t]);
-        args->jobMutex = &(jobMutex);
+    void device::free() {
+      pool.stop();
+      serial::device::free();
+    }
 
-#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-        pthread_create(&tid[t], NULL, threads::limbo, args);
-#else
-        CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE) threads::limbo, args, 0, &tid[t]);
-#endif
-      }
+    void device::finish() const {
+      serial::device::finish();
+      pool.finish();
     }
 
-    device::~device() {}
+    hash_t device::kernelHash(const occa::properties &props) const {
+      return (
+        serial::device::kernelHash(props)
+        ^ occa::hash("threads")
+      );
+    }
 
-    void device::finish() const {
-      bool done = false;
-      while (!done) {
-        done = true;
-        for (int t = 0; t < threads; ++t) {
-          if (jobs[t].size()) {
-            done = false;
-            break;
-          }
+    //---[ Kernel ]---------------------
+    bool device::parseFile(const std::string &filename,
+                           const std::string &outputFile,
+                           const occa::properties &kernelProps,
+                           lang::kernelMetadataMap &metadata,
+                           strVector &dependencies) {
+      lang::okl::threadsParser parser(kernelProps);
+      parser.parseFile(filename);
+
+      // Verify if parsing succeeded
+      if (!parser.succeeded()) {
+        OCCA_ERROR("Unable to transform OKL kernel",
+                   kernelProps.get("silent", false));
+        return false;
+      }
+
+      if (!io::isFile(outputFile)) {
+        hash_t hash = occa::hash(outputFile);
+        io::lock_t lock(hash, "threads-parser");
+        if (lock.isMine()) {
+          parser.writeToFile(outputFile);
         }
       }
-    }
 
-    //---[ Stream ]---------------------
-    streamTag device::tagStream() const {
-      streamTag ret;
-      ret.tagTime = sys::currentTime();
-      return ret;
-    }
+      parser.setMetadata(metadata);
+      parser.setDependencies(dependencies);
 
-    void device::waitFor(streamTag tag) const {
-      finish(); // [-] Not done
+      return true;
     }
 
-    double device::timeBetween(const streamTag &startTag, const streamTag &endTag) const {
-      return (endTag.tagTime - startTag.tagTime);
-    }
-    //==================================
+    modeKernel_t* device::buildKernelFromBinary(const std::string &filename,
+                                                const std::string &kernelName,
+                                                const occa::properties &kernelProps) {
+      kernel &k = *(new kernel(this,
+                               kernelName,
+                               filename,
+                               kernelProps));
 
-    //---[ Kernel ]---------------------
-    lang::kernelMetadataMap device::parseFile(const std::string &filename,
-                                              const std::string &outputFile,
-                                              const occa::properties &props) {
-      return lang::kernelMetadataMap();
-    }
-    //==================================
+      k.binaryFilename = filename;
+
+      k.dlHandle = sys::dlopen(filename);
+      k.function = sys::dlsym(k.dlHandle, kernelName);
+      k.trampoline = (trampolinePtr_t) (
+        sys::dlsymIfExists(k.dlHandle,
+                           lang::okl::serialParser::trampolinePrefix + kernelName)
+      );
 
-    //---[ Custom ]---------------------
-    void device::addJob(job_t &job) {
-      jobMutex.lock();
-      jobs[job.rank].push(job);
-      jobMutex.unlock();
+      return &k;
     }
     //==================================
   }
 }
-
-#endif
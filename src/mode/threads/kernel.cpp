@@ -19,7 +19,6 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
-#if 0
 
 #include <occa/mode/threads/kernel.hpp>
 #include <occa/mode/threads/device.hpp>
@@ -32,38 +31,42 @@ namespace occa {
                    const std::string &name_,
                    const std::string &sourceFilename_,
                    const occa::properties &properties_) :
-      serial::kernel(modeDevice_, name_, sourceFilename_, properties_) {
-
-      threads = properties.get("threads", sys::getCoreCount());
-    }
+      serial::kernel(modeDevice_, name_, sourceFilename_, properties_) {}
 
     kernel::~kernel() {}
 
-    void kernel::run() const {
-      job_t job;
+    void kernel::launch(const int userArgc,
+                        void **args) const {
+      // The last argument is [_occa_thread_info]
+      const int argc = userArgc + 1;
+      threadPool_t &pool = ((device*) modeDevice)->pool;
 
-      job.count  = threads;
-      job.handle = handle;
-      job.inner  = inner;
-      job.outer  = outer;
+      int info[threadInfo::size];
+      args[argc - 1] = info;
 
-      const int argc = kernelArg::argumentCount(kArgc, kArgs);
-      for (int i = 0; i < argc; ++i) {
-        const int argCount = (int) kArgs[i].args.size();
-        if (argCount) {
-          const kernelArgData *kArgs_i = &(kArgs[i].args[0]);
-          for (int j = 0; j < argCount; ++j) {
-            job.args.push_back(kArgs_i[j].ptr());
-          }
+      // Outer-most loops run in order, each one split across the pool
+      for (int loopIndex = 0; ; ++loopIndex) {
+        info[threadInfo::loop]  = -(loopIndex + 1);
+        info[threadInfo::start] = 0;
+        info[threadInfo::end]   = 0;
+        info[threadInfo::count] = 0;
+        info[threadInfo::found] = 0;
+
+        if (trampoline) {
+          trampoline(args);
+        } else {
+          sys::runFunction(function, argc, args);
+        }
+        if (!info[threadInfo::found]) {
+          break;
+        }
+        if (info[threadInfo::count] <= 0) {
+          continue;
         }
-      }
 
-      for (int t = 0; t < threads; ++t) {
-        job.rank = t;
-        ((device*) modeDevice)->addJob(job);
+        job_t job(function, trampoline, argc, args, loopIndex);
+        pool.run(job, info[threadInfo::count]);
       }
     }
   }
 }
-
-#endif
@@ -19,7 +19,6 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
-#if 0
 
 #include <occa/mode/threads/registration.hpp>
 
@@ -29,9 +28,7 @@ namespace occa {
 
     void modeInfo::init() {}
 
-    // occa::mode<threads::modeInfo,
-    //            threads::device> mode("Threads");
+    occa::mode<threads::modeInfo,
+               threads::device> mode("Threads");
   }
 }
-
-#endif
@@ -21,7 +21,6 @@
  */
 
 #include <occa/tools/sys.hpp>
-#include <occa/mode/serial/kernel.hpp>
 #include <occa/mode/threads/utils.hpp>
 
 namespace occa {
@@ -36,61 +35,259 @@ namespace occa {
       return "compact";
     }
 
-    job_t::job_t() {}
+    job_t::job_t(functionPtr_t function_,
+                 trampolinePtr_t trampoline_,
+                 const int argc_,
+                 void **args_,
+                 const int loop_) :
+      function(function_),
+      trampoline(trampoline_),
+      argc(argc_),
+      args(args_),
+      loop(loop_),
+      pendingChunks(0) {}
 
-    job_t::job_t(const job_t &job) {
-      *this = job;
+    chunk_t::chunk_t() :
+      job(NULL),
+      start(0),
+      end(0) {}
+
+    chunk_t::chunk_t(job_t *job_,
+                     const int start_,
+                     const int end_) :
+      job(job_),
+      start(start_),
+      end(end_) {}
+
+    worker_t::worker_t(threadPool_t *pool_,
+                       const int rank_,
+                       const int pinnedCore_) :
+      pool(pool_),
+      rank(rank_),
+      pinnedCore(pinnedCore_) {}
+
+    void worker_t::free() {
+      chunkMutex.free();
+    }
+
+    void worker_t::push(const chunk_t &chunk) {
+      chunkMutex.lock();
+      chunks.push_back(chunk);
+      chunkMutex.unlock();
+    }
+
+    bool worker_t::pop(chunk_t &chunk) {
+      chunkMutex.lock();
+      const bool hasChunk = !chunks.empty();
+      if (hasChunk) {
+        chunk = chunks.front();
+        chunks.pop_front();
+      }
+      chunkMutex.unlock();
+      return hasChunk;
     }
 
-    job_t& job_t::operator = (const job_t &job) {
-      rank     = job.rank;
-      count    = job.count;
-      schedule = job.schedule;
+    bool worker_t::steal(chunk_t &chunk) {
+      chunkMutex.lock();
+      const bool hasChunk = !chunks.empty();
+      if (hasChunk) {
+        chunk = chunks.back();
+        chunks.pop_back();
+      }
+      chunkMutex.unlock();
+      return hasChunk;
+    }
 
-      function = job.function;
+    void worker_t::run(const chunk_t &chunk) {
+      job_t &job = *(chunk.job);
 
-      dims  = job.dims;
-      inner = job.inner;
-      outer = job.outer;
+      int info[threadInfo::size];
+      info[threadInfo::loop]  = job.loop;
+      info[threadInfo::start] = chunk.start;
+      info[threadInfo::end]   = chunk.end;
+      info[threadInfo::count] = 0;
+      info[threadInfo::found] = 0;
 
-      args = job.args;
+      // Each worker passes its own [_occa_thread_info]
+      if ((int) args.size() < job.argc) {
+        args.resize(job.argc);
+      }
+      for (int i = 0; i < (job.argc - 1); ++i) {
+        args[i] = job.args[i];
+      }
+      args[job.argc - 1] = info;
 
-      return *this;
+      if (job.trampoline) {
+        job.trampoline(&(args[0]));
+      } else {
+        sys::runFunction(job.function,
+                         job.argc,
+                         &(args[0]));
+      }
+    }
+    //==================================
+
+    //---[ Pool ]-----------------------
+    threadPool_t::threadPool_t() :
+      chunksPerThread(1),
+      queuedChunks(0),
+      stopping(false),
+      activeJobs(0) {}
+
+    void threadPool_t::start(const std::vector<int> &pinnedCores,
+                             const int chunksPerThread_) {
+      chunksPerThread = chunksPerThread_;
+
+      const int threads = (int) pinnedCores.size();
+      for (int t = 0; t < threads; ++t) {
+        worker_t *worker = new worker_t(this, t, pinnedCores[t]);
+        workers.push_back(worker);
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+        pthread_create(&(worker->tid), NULL, threads::workerLoop, worker);
+#else
+        worker->tid = CreateThread(NULL, 0,
+                                   (LPTHREAD_START_ROUTINE) threads::workerLoop,
+                                   worker, 0, NULL);
+#endif
+      }
+    }
+
+    void threadPool_t::stop() {
+      if (workers.empty()) {
+        return;
+      }
+      finish();
+
+      workCondition.lock();
+      stopping = true;
+      workCondition.broadcast();
+      workCondition.unlock();
+
+      const int threads = size();
+      for (int t = 0; t < threads; ++t) {
+        worker_t *worker = workers[t];
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+        pthread_join(worker->tid, NULL);
+#else
+        WaitForSingleObject(worker->tid, INFINITE);
+        CloseHandle(worker->tid);
+#endif
+        worker->free();
+        delete worker;
+      }
+      workers.clear();
+
+      workCondition.free();
+      doneCondition.free();
+    }
+
+    int threadPool_t::size() const {
+      return (int) workers.size();
+    }
+
+    void threadPool_t::run(job_t &job,
+                           const int iterations) {
+      const int threads = size();
+      int chunks = threads * chunksPerThread;
+      if (chunks > iterations) {
+        chunks = iterations;
+      }
+      if (chunks <= 0) {
+        return;
+      }
+
+      job.pendingChunks = chunks;
+
+      doneCondition.lock();
+      ++activeJobs;
+      doneCondition.unlock();
+
+      // Contiguous chunks go to the same worker, idle workers steal the rest
+      workCondition.lock();
+      for (int c = 0; c < chunks; ++c) {
+        const int start = (int) (((long long) c * iterations) / chunks);
+        const int end   = (int) (((long long) (c + 1) * iterations) / chunks);
+        workers[(c * threads) / chunks]->push(chunk_t(&job, start, end));
+      }
+      queuedChunks += chunks;
+      workCondition.broadcast();
+      workCondition.unlock();
+
+      doneCondition.lock();
+      while (job.pendingChunks) {
+        doneCondition.wait();
+      }
+      doneCondition.unlock();
+    }
+
+    void threadPool_t::finish() {
+      doneCondition.lock();
+      while (activeJobs) {
+        doneCondition.wait();
+      }
+      doneCondition.unlock();
+    }
+
+    bool threadPool_t::getChunk(worker_t &worker,
+                                chunk_t &chunk) {
+      bool hasChunk = worker.pop(chunk);
+
+      const int threads = size();
+      for (int i = 1; !hasChunk && (i < threads); ++i) {
+        hasChunk = workers[(worker.rank + i) % threads]->steal(chunk);
+      }
+
+      if (hasChunk) {
+        workCondition.lock();
+        --queuedChunks;
+        workCondition.unlock();
+      }
+      return hasChunk;
+    }
+
+    void threadPool_t::chunkFinished(const chunk_t &chunk) {
+      doneCondition.lock();
+      if (--(chunk.job->pendingChunks) == 0) {
+        --activeJobs;
+        doneCondition.broadcast();
+      }
+      doneCondition.unlock();
     }
     //==================================
 
     //---[ Functions ]------------------
-    void* limbo(void *args) {
-      workerData_t &data = *((workerData_t*) args);
+    void* workerLoop(void *args) {
+      worker_t &worker = *((worker_t*) args);
+      threadPool_t &pool = *(worker.pool);
 
-      sys::pinToCore(data.pinnedCore);
+      if (worker.pinnedCore >= 0) {
+        sys::pinToCore(worker.pinnedCore);
+      }
 
-      bool hasJob;
-      job_t job;
+      chunk_t chunk;
+      while (true) {
+        if (pool.getChunk(worker, chunk)) {
+          worker.run(chunk);
+          pool.chunkFinished(chunk);
+          continue;
+        }
 
-      while(true) {
-        hasJob = false;
-        data.jobMutex->lock();
-        if (data.jobs->size()) {
-          hasJob = true;
-          job    = data.jobs->front();
-          data.jobs->pop();
+        // Sleep until chunks are queued
+        pool.workCondition.lock();
+        while (!pool.queuedChunks && !pool.stopping) {
+          pool.workCondition.wait();
         }
-        data.jobMutex->unlock();
+        const bool stopping = pool.stopping;
+        pool.workCondition.unlock();
 
-        if (hasJob) {
-          run(job);
+        if (stopping) {
+          break;
         }
       }
 
       return NULL;
     }
-
-    void run(job_t &job) {
-      sys::runFunction(job.function,
-                       (int) job.args.size(),
-                       &(job.args[0]));
-    }
     //==================================
   }
 }
@@ -20,9 +20,14 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 
+#include <cstdio>
+#include <cstring>
 #include <sstream>
 #include <stdint.h>
 
+#include <map>
+#include <sys/stat.h>
+
 #include <occa/types.hpp>
 #include <occa/tools/hash.hpp>
 #include <occa/tools/env.hpp>
@@ -148,27 +153,129 @@ namespace occa {
     return out;
   }
 
-  hash_t hash(const void *ptr, udim_t bytes) {
-    std::stringstream ss;
-    const char *c = (char*) ptr;
+  //---[ Hasher ]-----------------------
+  // Multipliers from xxHash64
+  const uint64_t hashPrime1 = 0x9E3779B185EBCA87ULL;
+  const uint64_t hashPrime2 = 0xC2B2AE3D27D4EB4FULL;
+  const uint64_t hashPrime3 = 0x165667B19E3779F9ULL;
+  const uint64_t hashPrime4 = 0x85EBCA77C2B2AE63ULL;
 
-    hash_t hash;
-    int *h = hash.h;
+  uint64_t hasher_t::rotl(const uint64_t x, const int r) {
+    return ((x << r) | (x >> (64 - r)));
+  }
+
+  uint64_t hasher_t::readWord(const unsigned char *c) {
+    uint64_t word;
+    ::memcpy(&word, c, sizeof(uint64_t));
+    return word;
+  }
+
+  uint64_t hasher_t::mixWord(uint64_t lane, const uint64_t word) {
+    lane += word * hashPrime2;
+    lane = rotl(lane, 31);
+    return lane * hashPrime1;
+  }
+
+  uint64_t hasher_t::avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= hashPrime2;
+    h ^= h >> 29;
+    h *= hashPrime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  hasher_t::hasher_t() {
+    clear();
+  }
+
+  void hasher_t::clear() {
+    lanes[0] = hashPrime1 + hashPrime2;
+    lanes[1] = hashPrime2;
+    lanes[2] = 0;
+    lanes[3] = -hashPrime1;
+    stripeBytes = 0;
+    totalBytes = 0;
+  }
+
+  void hasher_t::consumeStripe(const unsigned char *c) {
+    // Lanes are independent, letting the compiler vectorize the stripe
+    lanes[0] = mixWord(lanes[0], readWord(c));
+    lanes[1] = mixWord(lanes[1], readWord(c + 8));
+    lanes[2] = mixWord(lanes[2], readWord(c + 16));
+    lanes[3] = mixWord(lanes[3], readWord(c + 24));
+  }
 
-    const int p[8] = {
-      102679, 102701, 102761, 102763,
-      102769, 102793, 102797, 102811
+  hasher_t& hasher_t::update(const void *ptr, udim_t bytes) {
+    const unsigned char *c = (const unsigned char*) ptr;
+    totalBytes += bytes;
+
+    // Finish a partially filled stripe first
+    if (stripeBytes) {
+      const int missing = 32 - stripeBytes;
+      if (bytes < (udim_t) missing) {
+        ::memcpy(stripe + stripeBytes, c, bytes);
+        stripeBytes += (int) bytes;
+        return *this;
+      }
+      ::memcpy(stripe + stripeBytes, c, missing);
+      consumeStripe(stripe);
+      c += missing;
+      bytes -= missing;
+      stripeBytes = 0;
+    }
+
+    while (bytes >= 32) {
+      consumeStripe(c);
+      c += 32;
+      bytes -= 32;
+    }
+
+    if (bytes) {
+      ::memcpy(stripe, c, bytes);
+      stripeBytes = (int) bytes;
+    }
+    return *this;
+  }
+
+  hasher_t& hasher_t::update(const std::string &str) {
+    return update(str.c_str(), str.size());
+  }
+
+  hash_t hasher_t::digest() const {
+    uint64_t l[4] = {
+      lanes[0], lanes[1], lanes[2], lanes[3]
     };
 
-    for (udim_t i = 0; i < bytes; ++i) {
-      for (int j = 0; j < 8; ++j) {
-        h[j] = (h[j] * p[j]) ^ c[i];
+    // Zero-pad the tail, the total size below keeps padding distinct
+    if (stripeBytes) {
+      unsigned char tail[32];
+      ::memset(tail, 0, 32);
+      ::memcpy(tail, stripe, stripeBytes);
+      for (int i = 0; i < 4; ++i) {
+        l[i] = mixWord(l[i], readWord(tail + (8 * i)) ^ hashPrime4);
       }
     }
-    hash.initialized = true;
 
+    const uint64_t merged = (rotl(l[0], 1) + rotl(l[1], 7)
+                             + rotl(l[2], 12) + rotl(l[3], 18)
+                             + (totalBytes * hashPrime3));
+
+    hash_t hash;
+    for (int i = 0; i < 4; ++i) {
+      const uint64_t h = avalanche(l[i] ^ rotl(merged, 8 * i + 1)
+                                   ^ ((uint64_t) i * hashPrime4));
+      hash.h[2*i]     = (int) (h & 0xFFFFFFFF);
+      hash.h[2*i + 1] = (int) (h >> 32);
+    }
+    hash.initialized = true;
     return hash;
   }
+  //====================================
+
+  hash_t hash(const void *ptr, udim_t bytes) {
+    return hasher_t().update(ptr, bytes).digest();
+  }
 
   hash_t hash(const char *c) {
     return hash(c, strlen(c));
@@ -178,10 +285,90 @@ namespace occa {
     return hash(str.c_str(), str.size());
   }
 
+  hash_t hashFileContents(const std::string &filename) {
+    FILE *fp = fopen(filename.c_str(), "rb");
+    OCCA_ERROR("Failed to open [" << io::shortname(filename) << "]",
+               fp != NULL);
+
+    // Stream the file instead of reading it all at once
+    hasher_t hasher;
+    char buffer[1 << 16];
+    while (true) {
+      const size_t nread = fread(buffer, sizeof(char), sizeof(buffer), fp);
+      hasher.update(buffer, nread);
+      if (nread < sizeof(buffer)) {
+        break;
+      }
+    }
+    fclose(fp);
+
+    return hasher.digest();
+  }
+
+  //---[ File Stamp ]-------------------
+  fileStamp_t::fileStamp_t() :
+    bytes(0),
+    modifiedTime(0),
+    modifiedTimeNs(0) {}
+
+  bool fileStamp_t::load(const std::string &filename) {
+    struct stat statInfo;
+    if (stat(filename.c_str(), &statInfo) != 0) {
+      return false;
+    }
+
+    bytes = (udim_t) statInfo.st_size;
+    modifiedTime = (int64_t) statInfo.st_mtime;
+#if (OCCA_OS == OCCA_LINUX_OS)
+    modifiedTimeNs = (int64_t) statInfo.st_mtim.tv_nsec;
+#elif (OCCA_OS == OCCA_MACOS_OS)
+    modifiedTimeNs = (int64_t) statInfo.st_mtimespec.tv_nsec;
+#else
+    modifiedTimeNs = 0;
+#endif
+    return true;
+  }
+
+  bool fileStamp_t::sameModification(const fileStamp_t &other) const {
+    return ((bytes == other.bytes) &&
+            (modifiedTime == other.modifiedTime) &&
+            (modifiedTimeNs == other.modifiedTimeNs));
+  }
+  //====================================
+
+  fileStamp_t fileStamp(const std::string &filename) {
+    static mutex fileStampMutex;
+    static std::map<std::string, fileStamp_t> fileStamps;
+
+    const std::string expFilename = io::filename(filename);
+
+    fileStamp_t stamp;
+    if (!stamp.load(expFilename)) {
+      // Reports the missing file
+      stamp.hash = hashFileContents(expFilename);
+      return stamp;
+    }
+
+    fileStampMutex.lock();
+    std::map<std::string, fileStamp_t>::iterator it = fileStamps.find(expFilename);
+    if ((it != fileStamps.end()) &&
+        it->second.sameModification(stamp)) {
+      stamp = it->second;
+      fileStampMutex.unlock();
+      return stamp;
+    }
+    fileStampMutex.unlock();
+
+    stamp.hash = hashFileContents(expFilename);
+
+    fileStampMutex.lock();
+    fileStamps[expFilename] = stamp;
+    fileStampMutex.unlock();
+
+    return stamp;
+  }
+
   hash_t hashFile(const std::string &filename) {
-    const char *c = io::c_read(io::filename(filename));
-    hash_t ret = hash(c);
-    delete [] c;
-    return ret;
+    return fileStamp(filename).hash;
   }
 }
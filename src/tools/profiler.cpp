@@ -0,0 +1,219 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <fstream>
+
+#include <occa/tools/env.hpp>
+#include <occa/tools/profiler.hpp>
+
+namespace occa {
+  namespace profileCategory {
+    const std::string kernel  = "kernel";
+    const std::string malloc  = "malloc";
+    const std::string free    = "free";
+    const std::string copy    = "copy";
+    const std::string sync    = "sync";
+    const std::string build   = "build";
+    const std::string parse   = "parse";
+    const std::string compile = "compile";
+    const std::string load    = "load";
+  }
+
+  profileEvent_t::profileEvent_t(const std::string &category_,
+                                 const std::string &name_,
+                                 const double start_,
+                                 const double end_,
+                                 const udim_t bytes_) :
+    category(category_),
+    name(name_),
+    start(start_),
+    end(end_),
+    bytes(bytes_),
+    threadId(sys::getTID()) {}
+
+  //---[ profiler_t ]-------------------
+  profiler_t profiler;
+
+  profiler_t::profiler_t() :
+    enabled(false),
+    startTime(0) {
+    const std::string profile = env::var("OCCA_PROFILE");
+    if (profile.size()) {
+      if ((profile != "1") && (profile != "true")) {
+        outputFilename = profile;
+      }
+      enable();
+    }
+  }
+
+  profiler_t::~profiler_t() {
+    if (outputFilename.size() && events.size()) {
+      write(outputFilename);
+    }
+    eventMutex.free();
+  }
+
+  void profiler_t::enable() {
+    if (!startTime) {
+      startTime = sys::currentTime();
+    }
+    enabled = true;
+  }
+
+  void profiler_t::disable() {
+    enabled = false;
+  }
+
+  void profiler_t::clear() {
+    eventMutex.lock();
+    events.clear();
+    eventMutex.unlock();
+  }
+
+  int profiler_t::size() {
+    eventMutex.lock();
+    const int eventCount = (int) events.size();
+    eventMutex.unlock();
+    return eventCount;
+  }
+
+  void profiler_t::record(const std::string &category,
+                          const std::string &name,
+                          const double start,
+                          const double end,
+                          const udim_t bytes) {
+    if (!enabled) {
+      return;
+    }
+    profileEvent_t event(category, name, start, end, bytes);
+    eventMutex.lock();
+    events.push_back(event);
+    eventMutex.unlock();
+  }
+
+  json profiler_t::getStats() {
+    json stats;
+    stats.asObject();
+
+    eventMutex.lock();
+    const int eventCount = (int) events.size();
+    for (int i = 0; i < eventCount; ++i) {
+      const profileEvent_t &event = events[i];
+      const double duration = event.end - event.start;
+
+      json &entry = stats[event.category][event.name];
+      if (!entry.isInitialized()) {
+        entry["count"] = 0;
+        entry["total"] = 0.0;
+        entry["min"]   = duration;
+        entry["max"]   = duration;
+        // 64-bit integers are printed with an L suffix, keep JSON valid
+        entry["bytes"] = 0.0;
+      }
+      entry["count"] = (int) entry["count"] + 1;
+      entry["total"] = (double) entry["total"] + duration;
+      entry["bytes"] = (double) entry["bytes"] + (double) event.bytes;
+      if (duration < (double) entry["min"]) {
+        entry["min"] = duration;
+      }
+      if ((double) entry["max"] < duration) {
+        entry["max"] = duration;
+      }
+    }
+    eventMutex.unlock();
+
+    // Add averages
+    const strVector categories = stats.keys();
+    const int categoryCount = (int) categories.size();
+    for (int i = 0; i < categoryCount; ++i) {
+      json &category = stats[categories[i]];
+      const strVector names = category.keys();
+      const int nameCount = (int) names.size();
+      for (int j = 0; j < nameCount; ++j) {
+        json &entry = category[names[j]];
+        entry["average"] = (double) entry["total"] / (int) entry["count"];
+      }
+    }
+
+    return stats;
+  }
+
+  json profiler_t::toJson() {
+    json trace;
+    json &traceEvents = trace["traceEvents"].asArray();
+    const int pid = sys::getPID();
+
+    eventMutex.lock();
+    const int eventCount = (int) events.size();
+    for (int i = 0; i < eventCount; ++i) {
+      const profileEvent_t &event = events[i];
+
+      // Chrome traces use microseconds
+      json traceEvent;
+      traceEvent["name"] = event.name;
+      traceEvent["cat"]  = event.category;
+      traceEvent["ph"]   = "X";
+      traceEvent["ts"]   = 1e6 * (event.start - startTime);
+      traceEvent["dur"]  = 1e6 * (event.end - event.start);
+      traceEvent["pid"]  = pid;
+      traceEvent["tid"]  = event.threadId;
+      if (event.bytes) {
+        traceEvent["args"]["bytes"] = (double) event.bytes;
+      }
+      traceEvents += traceEvent;
+    }
+    eventMutex.unlock();
+
+    trace["displayTimeUnit"] = "ms";
+    trace["stats"] = getStats();
+    return trace;
+  }
+
+  void profiler_t::write(const std::string &filename) {
+    // Avoid io:: helpers, this can run during static destruction
+    std::ofstream out(filename.c_str());
+    out << toJson().dump(0);
+  }
+  //====================================
+
+  //---[ profileScope_t ]---------------
+  profileScope_t::profileScope_t(const std::string &category_,
+                                 const std::string &name_,
+                                 const udim_t bytes_) :
+    enabled(profiler.isEnabled()),
+    start(0),
+    bytes(bytes_) {
+    if (enabled) {
+      category = category_;
+      name = name_;
+      start = sys::currentTime();
+    }
+  }
+
+  profileScope_t::~profileScope_t() {
+    if (enabled) {
+      profiler.record(category, name,
+                      start, sys::currentTime(),
+                      bytes);
+    }
+  }
+  //====================================
+}
@@ -31,14 +31,17 @@
 #  include <pthread.h>
 #  include <signal.h>
 #  include <stdio.h>
+#  include <poll.h>
 #  include <sys/types.h>
 #  include <sys/stat.h>
 #  include <sys/syscall.h>
+#  include <sys/wait.h>
 #  include <sys/sysctl.h>
 #  include <sys/time.h>
 #  include <unistd.h>
+#  include <errno.h>
+#  include <wordexp.h>
 #  if (OCCA_OS & OCCA_LINUX_OS)
-#    include <errno.h>
 #    include <sys/sysinfo.h>
 #  else // OCCA_MACOS_OS
 #    include <mach/mach_host.h>
@@ -408,6 +411,243 @@ namespace occa {
     }
     //==================================
 
+    //---[ Processes ]------------------
+    std::string joinCommand(const strVector &args) {
+      std::string cmdline;
+      const int argCount = (int) args.size();
+      for (int i = 0; i < argCount; ++i) {
+        const std::string &arg = args[i];
+        if (i) {
+          cmdline += ' ';
+        }
+        if (arg.size()
+            && (arg.find_first_of(" \t\n'\"\\$`") == std::string::npos)) {
+          cmdline += arg;
+          continue;
+        }
+        // 'it'\''s' -> it's
+        cmdline += '\'';
+        const int chars = (int) arg.size();
+        for (int c = 0; c < chars; ++c) {
+          if (arg[c] == '\'') {
+            cmdline += "'\\''";
+          } else {
+            cmdline += arg[c];
+          }
+        }
+        cmdline += '\'';
+      }
+      return cmdline;
+    }
+
+    strVector splitCommand(const std::string &cmdline) {
+      strVector args;
+      std::string arg;
+      bool hasArg = false;
+
+      const char *c = cmdline.c_str();
+      while (*c != '\0') {
+        if (lex::isWhitespace(*c)) {
+          if (hasArg) {
+            args.push_back(arg);
+            arg.clear();
+            hasArg = false;
+          }
+          ++c;
+          continue;
+        }
+        hasArg = true;
+        if (*c == '\'') {
+          // Everything is literal inside single quotes
+          ++c;
+          while ((*c != '\0') && (*c != '\'')) {
+            arg += *(c++);
+          }
+        } else if (*c == '"') {
+          ++c;
+          while ((*c != '\0') && (*c != '"')) {
+            if ((*c == '\\')
+                && ((c[1] == '"') || (c[1] == '\\'))) {
+              ++c;
+            }
+            arg += *(c++);
+          }
+        } else if ((*c == '\\') && (c[1] != '\0')) {
+          arg += *(++c);
+        } else {
+          arg += *c;
+        }
+        if (*c != '\0') {
+          ++c;
+        }
+      }
+      if (hasArg) {
+        args.push_back(arg);
+      }
+      return args;
+    }
+
+    strVector expandCommand(const std::string &cmdline) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      wordexp_t words;
+      const int error = ::wordexp(cmdline.c_str(), &words, 0);
+      if (!error) {
+        strVector args;
+        for (size_t i = 0; i < words.we_wordc; ++i) {
+          args.push_back(words.we_wordv[i]);
+        }
+        ::wordfree(&words);
+        return args;
+      }
+      // Only WRDE_NOSPACE leaves [words] allocated
+      if (error == WRDE_NOSPACE) {
+        ::wordfree(&words);
+      }
+#endif
+      return splitCommand(cmdline);
+    }
+
+    strVector compilerCommand(const std::string &compiler,
+                              const std::string &compilerFlags,
+                              const std::string &compilerEnvScript,
+                              const strVector &args) {
+      strVector command = expandCommand(compiler);
+      strVector flags = expandCommand(compilerFlags);
+      command.insert(command.end(), flags.begin(), flags.end());
+      command.insert(command.end(), args.begin(), args.end());
+
+      if (!compilerEnvScript.size()) {
+        return command;
+      }
+      // The script sets up the environment the compiler runs in
+      strVector shellCommand;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      shellCommand.push_back("/bin/sh");
+      shellCommand.push_back("-c");
+#else
+      shellCommand.push_back("cmd");
+      shellCommand.push_back("/C");
+#endif
+      shellCommand.push_back(compilerEnvScript + " && " + joinCommand(command));
+      return shellCommand;
+    }
+
+    int runProcess(const strVector &args,
+                   std::string &output,
+                   const double timeout) {
+      OCCA_ERROR("No process to run",
+                 args.size() > 0);
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      processLimit_t &limit = processLimit_t::get();
+      limit.acquire();
+
+      // Build everything the child needs before forking
+      std::vector<char*> argv;
+      const int argCount = (int) args.size();
+      for (int i = 0; i < argCount; ++i) {
+        argv.push_back(const_cast<char*>(args[i].c_str()));
+      }
+      argv.push_back(NULL);
+      const std::string execError = "Unable to run [" + args[0] + "]\n";
+
+      // Close-on-exec keeps processes started by other threads
+      //   from holding the pipe open
+      int fds[2];
+#if (OCCA_OS & OCCA_LINUX_OS)
+      const int pipeError = ::pipe2(fds, O_CLOEXEC);
+#else
+      int pipeError = ::pipe(fds);
+      if (!pipeError) {
+        ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        ::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+      }
+#endif
+      if (pipeError) {
+        limit.release();
+        output += execError;
+        return -1;
+      }
+
+      const pid_t pid = ::fork();
+      if (pid == 0) {
+        ::dup2(fds[1], STDOUT_FILENO);
+        ::dup2(fds[1], STDERR_FILENO);
+        ::execvp(argv[0], &(argv[0]));
+        // Only reached if exec failed
+        ignoreResult( ::write(STDERR_FILENO, execError.c_str(), execError.size()) );
+        ::_exit(127);
+      }
+      ::close(fds[1]);
+      if (pid < 0) {
+        ::close(fds[0]);
+        limit.release();
+        output += execError;
+        return -1;
+      }
+
+      const double start = currentTime();
+      bool timedOut = false;
+      char buffer[4096];
+      while (true) {
+        int waitMs = -1;
+        if (timeout > 0) {
+          const double timeLeft = timeout - (currentTime() - start);
+          if (timeLeft <= 0) {
+            timedOut = true;
+            break;
+          }
+          waitMs = (int) (1000 * timeLeft) + 1;
+        }
+
+        struct pollfd pipeInfo;
+        pipeInfo.fd = fds[0];
+        pipeInfo.events = POLLIN;
+        pipeInfo.revents = 0;
+        const int ready = ::poll(&pipeInfo, 1, waitMs);
+        if (ready < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          break;
+        }
+        if (ready == 0) {
+          continue;
+        }
+
+        const ssize_t bytes = ::read(fds[0], buffer, sizeof(buffer));
+        if ((bytes < 0) && (errno == EINTR)) {
+          continue;
+        }
+        if (bytes <= 0) {
+          break;
+        }
+        output.append(buffer, bytes);
+      }
+      ::close(fds[0]);
+
+      if (timedOut) {
+        ::kill(pid, SIGKILL);
+      }
+      int status = 0;
+      while ((::waitpid(pid, &status, 0) < 0)
+             && (errno == EINTR)) {}
+      limit.release();
+
+      if (timedOut) {
+        output += "Killed [" + args[0] + "] after " + toString(timeout) + " seconds\n";
+        return -1;
+      }
+      if (WIFEXITED(status)) {
+        return WEXITSTATUS(status);
+      }
+      return -1;
+#else
+      return call("\"" + joinCommand(args) + "\" 2>&1", output);
+#endif
+    }
+    //==================================
+
     //---[ Processor Info ]-------------
     std::string getFieldFrom(const std::string &command,
                              const std::string &field) {
@@ -687,21 +927,24 @@ namespace occa {
       io::lock_t lock(hash, "compiler");
       if (lock.isMine()
           && !io::isFile(outFilename)) {
-        ss << compiler
-           << ' '    << srcFilename
-           << " -o " << binaryFilename
-           << " > " << buildLogFilename << " 2>&1";
-        const std::string compileLine = ss.str();
-
-        ignoreResult( system(compileLine.c_str()) );
-
-        OCCA_ERROR("Could not compile compilerVendorTest.cpp with following command:\n" << compileLine,
+        strVector args;
+        args.push_back(srcFilename);
+        args.push_back("-o");
+        args.push_back(binaryFilename);
+        const strVector command = compilerCommand(compiler, "", "", args);
+
+        std::string buildLog = joinCommand(command) + "\n";
+        runProcess(command, buildLog);
+        io::write(buildLogFilename, buildLog);
+
+        OCCA_ERROR("Could not compile compilerVendorTest.cpp with following command:\n"
+                   << joinCommand(command) << "\n" << buildLog,
                    io::isFile(binaryFilename));
 
-        int exitStatus = system(binaryFilename.c_str());
-        int vendorBit  = WEXITSTATUS(exitStatus);
+        std::string output;
+        const int vendorBit = runProcess(strVector(1, binaryFilename), output);
 
-        if (vendorBit < sys::vendor::b_max) {
+        if ((0 <= vendorBit) && (vendorBit < sys::vendor::b_max)) {
           vendor_ = (1 << vendorBit);
         }
 
@@ -844,6 +1087,22 @@ namespace occa {
       return sym2;
     }
 
+    functionPtr_t dlsymIfExists(void *dlHandle,
+                                const std::string &functionName) {
+      OCCA_ERROR("dl handle is NULL",
+                 dlHandle);
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      void *sym = ::dlsym(dlHandle, functionName.c_str());
+#else
+      void *sym = GetProcAddress((HMODULE) dlHandle, functionName.c_str());
+#endif
+
+      functionPtr_t sym2;
+      ::memcpy(&sym2, &sym, sizeof(sym));
+      return sym2;
+    }
+
     void dlclose(void *dlHandle) {
       if (!dlHandle) {
         return;
@@ -1055,4 +1314,117 @@ namespace occa {
     ReleaseMutex(mutexHandle);
 #endif
   }
+
+  condition::condition() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    int error = pthread_mutex_init(&mutexHandle, NULL);
+    error = error || pthread_cond_init(&conditionHandle, NULL);
+#if OCCA_UNSAFE
+    ignoreResult(error);
+#endif
+
+    OCCA_ERROR("Error initializing condition",
+               error == 0);
+#else
+    InitializeCriticalSection(&mutexHandle);
+    InitializeConditionVariable(&conditionHandle);
+#endif
+  }
+
+  void condition::free() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    int error = pthread_cond_destroy(&conditionHandle);
+    error = error || pthread_mutex_destroy(&mutexHandle);
+#if OCCA_UNSAFE
+    ignoreResult(error);
+#endif
+
+    OCCA_ERROR("Error freeing condition",
+               error == 0);
+#else
+    DeleteCriticalSection(&mutexHandle);
+#endif
+  }
+
+  void condition::lock() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_mutex_lock(&mutexHandle);
+#else
+    EnterCriticalSection(&mutexHandle);
+#endif
+  }
+
+  void condition::unlock() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_mutex_unlock(&mutexHandle);
+#else
+    LeaveCriticalSection(&mutexHandle);
+#endif
+  }
+
+  void condition::wait() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_wait(&conditionHandle, &mutexHandle);
+#else
+    SleepConditionVariableCS(&conditionHandle, &mutexHandle, INFINITE);
+#endif
+  }
+
+  void condition::signal() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_signal(&conditionHandle);
+#else
+    WakeConditionVariable(&conditionHandle);
+#endif
+  }
+
+  void condition::broadcast() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_broadcast(&conditionHandle);
+#else
+    WakeAllConditionVariable(&conditionHandle);
+#endif
+  }
+
+  namespace sys {
+    processLimit_t::processLimit_t() :
+      running(0) {
+      maxRunning = 0;
+      const std::string jobs = env::var("OCCA_COMPILE_JOBS");
+      if (jobs.size()) {
+        maxRunning = ::atoi(jobs.c_str());
+      }
+      if (maxRunning <= 0) {
+        maxRunning = getCoreCount();
+      }
+      if (maxRunning <= 0) {
+        maxRunning = 1;
+      }
+    }
+
+    processLimit_t::~processLimit_t() {
+      slotCondition.free();
+    }
+
+    processLimit_t& processLimit_t::get() {
+      static processLimit_t limit;
+      return limit;
+    }
+
+    void processLimit_t::acquire() {
+      slotCondition.lock();
+      while (running >= maxRunning) {
+        slotCondition.wait();
+      }
+      ++running;
+      slotCondition.unlock();
+    }
+
+    void processLimit_t::release() {
+      slotCondition.lock();
+      --running;
+      slotCondition.signal();
+      slotCondition.unlock();
+    }
+  }
 }
@@ -0,0 +1,154 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/tuner.hpp>
+#include <occa/io.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  //---[ kernelTuner ]------------------
+  kernelTuner::kernelTuner(const std::string &filename_,
+                           const std::string &kernelName_,
+                           const occa::properties &props_) :
+    filename(io::filename(filename_)),
+    kernelName(kernelName_),
+    props(props_) {}
+
+  hash_t kernelTuner::hash(occa::device device) const {
+    return (device.hash()
+            ^ occa::hash(props)
+            ^ occa::hash(kernelName)
+            ^ hashFile(filename));
+  }
+
+  std::string kernelTuner::getCacheFilename(occa::device device) const {
+    return io::hashDir(hash(device)) + kc::tuneFile;
+  }
+
+  bool kernelTuner::isTuned(occa::device device) const {
+    return io::isFile(getCacheFilename(device));
+  }
+
+  intVector kernelTuner::getTunedOptions(occa::device device) const {
+    const std::string cacheFilename = getCacheFilename(device);
+    if (!io::isFile(cacheFilename)) {
+      return intVector();
+    }
+    json results = json::parse(io::read(cacheFilename));
+    return results.getArray<int>("options");
+  }
+
+  occa::kernel kernelTuner::build(occa::device device) const {
+    return build(device, getTunedOptions(device));
+  }
+
+  occa::kernel kernelTuner::build(occa::device device,
+                                  const intVector &options) const {
+    occa::properties kernelProps = props;
+    const int optionCount = (int) options.size();
+    if (optionCount) {
+      json &choices = kernelProps["okl/tune/" + kernelName].asArray();
+      for (int i = 0; i < optionCount; ++i) {
+        choices += options[i];
+      }
+    }
+    return device.buildKernel(filename, kernelName, kernelProps);
+  }
+
+  occa::kernel kernelTuner::tune(occa::device device,
+                                 kernelFrame frame,
+                                 const int iterations) const {
+    if (isTuned(device)) {
+      return build(device);
+    }
+
+    occa::kernel defaultKernel = build(device, intVector());
+    const std::vector<strVector> &tunables = (
+      defaultKernel.getModeKernel()->metadata.tunables
+    );
+
+    json results;
+    results["kernel"] = kernelName;
+    json &variants = results["variants"].asArray();
+
+    occa::kernel bestKernel = defaultKernel;
+    intVector bestOptions;
+    double bestTime = -1;
+
+    intVector options(tunables.size(), 0);
+    if (tunables.size()) {
+      do {
+        occa::kernel variant = build(device, options);
+        frame.setKernel(variant);
+
+        // Warm up before timing
+        frame.run();
+        device.finish();
+
+        const double start = sys::currentTime();
+        for (int i = 0; i < iterations; ++i) {
+          frame.run();
+        }
+        device.finish();
+        const double time = (sys::currentTime() - start) / iterations;
+
+        json variantInfo;
+        json &variantOptions = variantInfo["options"].asArray();
+        for (int i = 0; i < (int) options.size(); ++i) {
+          variantOptions += options[i];
+        }
+        variantInfo["time"] = time;
+        variants += variantInfo;
+
+        if ((bestTime < 0) || (time < bestTime)) {
+          bestKernel = variant;
+          bestOptions = options;
+          bestTime = time;
+        }
+      } while (nextOptions(tunables, options));
+    }
+
+    json &optionsInfo = results["options"].asArray();
+    json &valuesInfo = results["values"].asArray();
+    for (int i = 0; i < (int) bestOptions.size(); ++i) {
+      optionsInfo += bestOptions[i];
+      valuesInfo += tunables[i][bestOptions[i]];
+    }
+    results["time"] = bestTime;
+
+    io::write(getCacheFilename(device), results.dump());
+
+    return bestKernel;
+  }
+
+  bool kernelTuner::nextOptions(const std::vector<strVector> &tunables,
+                                intVector &options) {
+    const int tunableCount = (int) tunables.size();
+    for (int i = 0; i < tunableCount; ++i) {
+      if (++options[i] < (int) tunables[i].size()) {
+        return true;
+      }
+      options[i] = 0;
+    }
+    return false;
+  }
+  //====================================
+}
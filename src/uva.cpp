@@ -20,6 +20,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
 
+#include <cstring>
 #include <map>
 
 #include <occa/tools/misc.hpp>
@@ -28,8 +29,7 @@
 #include <occa/uva.hpp>
 
 namespace occa {
-  ptrRangeMap uvaMap;
-  memoryVector uvaStaleMemory;
+  uvaIndex uvaMap;
 
   //---[ ptrRange ]---------------------
   ptrRange::ptrRange() :
@@ -75,13 +75,338 @@ namespace occa {
   //====================================
 
 
-  //---[ UVA ]--------------------------
-  occa::modeMemory_t* uvaToMemory(void *ptr) {
+  //---[ uvaIndex ]---------------------
+  bool uvaIndex::retired_t::isEmpty() const {
+    return (snapshots.empty() && chunks.empty());
+  }
+
+  void uvaIndex::retired_t::swap(retired_t &other) {
+    snapshots.swap(other.snapshots);
+    chunks.swap(other.chunks);
+  }
+
+  void uvaIndex::retired_t::free() {
+    const int snapshotCount = (int) snapshots.size();
+    for (int i = 0; i < snapshotCount; ++i) {
+      delete [] snapshots[i]->chunks;
+      delete snapshots[i];
+    }
+    const int chunkCount = (int) chunks.size();
+    for (int i = 0; i < chunkCount; ++i) {
+      delete chunks[i];
+    }
+    snapshots.clear();
+    chunks.clear();
+  }
+
+  uvaIndex::uvaIndex() :
+    snapshot(NULL),
+    epoch(0) {
+    for (int i = 0; i < readerSlots; ++i) {
+      slots[i].readers[0] = 0;
+      slots[i].readers[1] = 0;
+    }
+  }
+
+  uvaIndex::~uvaIndex() {
+    pending.free();
+    retired.free();
+    if (snapshot) {
+      for (int i = 0; i < snapshot->chunkCount; ++i) {
+        delete snapshot->chunks[i];
+      }
+      delete [] snapshot->chunks;
+      delete snapshot;
+      // Memory freed during static destruction may still look up pointers
+      snapshot = NULL;
+    }
+    writeMutex.free();
+  }
+
+  int uvaIndex::findChunk(const snapshot_t *snap, const char *ptr) {
+    // Last chunk starting at or before ptr
+    int low = 0;
+    int high = snap->chunkCount;
+    while (low < high) {
+      const int mid = (low + high) / 2;
+      if (snap->chunks[mid]->entries[0].start <= ptr) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low - 1;
+  }
+
+  int uvaIndex::findEntry(const chunk_t *chunk, const char *ptr) {
+    // Last entry starting at or before ptr
+    int low = 0;
+    int high = chunk->size;
+    while (low < high) {
+      const int mid = (low + high) / 2;
+      if (chunk->entries[mid].start <= ptr) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low - 1;
+  }
+
+  bool uvaIndex::contains(const entry_t &entry, const char *ptr) {
+    // Empty ranges still match their start pointer
+    return ((ptr == entry.start) ||
+            (ptr < entry.end));
+  }
+
+  uvaIndex::readerSlot_t& uvaIndex::startReading(int &parity) const {
+    // Threads run on separate stacks, so the stack address spreads
+    //   concurrent readers across slots
+    int stackMarker;
+    const uint64_t slotHash = ((((uint64_t) &stackMarker) >> 12)
+                               * 0x9E3779B97F4A7C15ULL);
+    readerSlot_t &slot = slots[slotHash >> 60];
+
+    // Readers that raced with an epoch change retry in the new epoch,
+    //   so writers waiting on the old epoch never miss them
+    while (true) {
+      const int readerEpoch = __atomic_load_n(&epoch, __ATOMIC_SEQ_CST);
+      parity = (readerEpoch & 1);
+      __atomic_add_fetch(&slot.readers[parity], 1, __ATOMIC_SEQ_CST);
+      if (__atomic_load_n(&epoch, __ATOMIC_SEQ_CST) == readerEpoch) {
+        return slot;
+      }
+      __atomic_sub_fetch(&slot.readers[parity], 1, __ATOMIC_SEQ_CST);
+    }
+  }
+
+  void uvaIndex::stopReading(readerSlot_t &slot,
+                             const int parity) const {
+    __atomic_sub_fetch(&slot.readers[parity], 1, __ATOMIC_SEQ_CST);
+  }
+
+  bool uvaIndex::hasReaders(const int parity) const {
+    for (int i = 0; i < readerSlots; ++i) {
+      if (__atomic_load_n(&slots[i].readers[parity], __ATOMIC_SEQ_CST)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  occa::modeMemory_t* uvaIndex::find(const void *ptr) const {
     if (!ptr) {
       return NULL;
     }
-    ptrRangeMap::iterator it = uvaMap.find(ptr);
-    return (it == uvaMap.end()) ? NULL : it->second;
+    const char *cPtr = (const char*) ptr;
+
+    int parity;
+    readerSlot_t &slot = startReading(parity);
+    const snapshot_t *snap = __atomic_load_n(&snapshot, __ATOMIC_SEQ_CST);
+
+    occa::modeMemory_t *mem = NULL;
+    if (snap) {
+      const int chunkIndex = findChunk(snap, cPtr);
+      if (chunkIndex >= 0) {
+        const chunk_t *chunk = snap->chunks[chunkIndex];
+        const int entryIndex = findEntry(chunk, cPtr);
+        if (contains(chunk->entries[entryIndex], cPtr)) {
+          mem = chunk->entries[entryIndex].mem;
+        }
+      }
+    }
+
+    stopReading(slot, parity);
+    return mem;
+  }
+
+  size_t uvaIndex::size() const {
+    int parity;
+    readerSlot_t &slot = startReading(parity);
+    const snapshot_t *snap = __atomic_load_n(&snapshot, __ATOMIC_SEQ_CST);
+    const size_t entries = (snap ? snap->entryCount : 0);
+    stopReading(slot, parity);
+    return entries;
+  }
+
+  size_t uvaIndex::retiredSize() {
+    writeMutex.lock();
+    const size_t snapshots = (retired.snapshots.size()
+                              + pending.snapshots.size());
+    writeMutex.unlock();
+    return snapshots;
+  }
+
+  void uvaIndex::insert(const ptrRange &range,
+                        occa::modeMemory_t *mem) {
+    writeMutex.lock();
+
+    entry_t entry;
+    entry.start = range.start;
+    entry.end   = range.end;
+    entry.mem   = mem;
+
+    // Insert into the chunk covering the start, or the first chunk
+    int chunkIndex = -1;
+    const chunk_t *chunk = NULL;
+    if (snapshot && snapshot->chunkCount) {
+      chunkIndex = findChunk(snapshot, entry.start);
+      if (chunkIndex < 0) {
+        chunkIndex = 0;
+      }
+      chunk = snapshot->chunks[chunkIndex];
+    }
+
+    entry_t entries[chunkCapacity + 1];
+    int entryCount = 0;
+    int entryDelta = 1;
+    if (chunk) {
+      const int entryIndex = findEntry(chunk, entry.start);
+      const bool replace = ((entryIndex >= 0) &&
+                            (chunk->entries[entryIndex].start == entry.start));
+      const int tailIndex = entryIndex + 1;
+
+      ::memcpy(entries,
+               chunk->entries,
+               tailIndex * sizeof(entry_t));
+      entryCount = tailIndex;
+      if (replace) {
+        entries[entryIndex] = entry;
+        entryDelta = 0;
+      } else {
+        entries[entryCount++] = entry;
+      }
+      ::memcpy(entries + entryCount,
+               chunk->entries + tailIndex,
+               (chunk->size - tailIndex) * sizeof(entry_t));
+      entryCount += (chunk->size - tailIndex);
+    } else {
+      entries[entryCount++] = entry;
+    }
+
+    replaceChunk(chunkIndex, entries, entryCount, entryDelta);
+
+    writeMutex.unlock();
+  }
+
+  void uvaIndex::erase(const void *ptr) {
+    const char *cPtr = (const char*) ptr;
+    writeMutex.lock();
+
+    const int chunkIndex = (snapshot
+                            ? findChunk(snapshot, cPtr)
+                            : -1);
+    if (chunkIndex < 0) {
+      writeMutex.unlock();
+      return;
+    }
+
+    const chunk_t *chunk = snapshot->chunks[chunkIndex];
+    const int entryIndex = findEntry(chunk, cPtr);
+    if (!contains(chunk->entries[entryIndex], cPtr)) {
+      writeMutex.unlock();
+      return;
+    }
+
+    entry_t entries[chunkCapacity];
+    ::memcpy(entries,
+             chunk->entries,
+             entryIndex * sizeof(entry_t));
+    ::memcpy(entries + entryIndex,
+             chunk->entries + entryIndex + 1,
+             (chunk->size - entryIndex - 1) * sizeof(entry_t));
+
+    replaceChunk(chunkIndex, entries, chunk->size - 1, -1);
+
+    writeMutex.unlock();
+  }
+
+  void uvaIndex::replaceChunk(const int chunkIndex,
+                              const entry_t *entries,
+                              const int entryCount,
+                              const int entryDelta) {
+    snapshot_t *oldSnapshot = snapshot;
+    const int oldChunkCount = (oldSnapshot
+                               ? oldSnapshot->chunkCount
+                               : 0);
+
+    // Full chunks are split in half
+    const int newChunkCount = ((entryCount > chunkCapacity)
+                               ? 2
+                               : (entryCount ? 1 : 0));
+    chunk_t *newChunks[2];
+    int offset = 0;
+    for (int i = 0; i < newChunkCount; ++i) {
+      const int chunkEntries = ((i < (newChunkCount - 1))
+                                ? (entryCount / 2)
+                                : (entryCount - offset));
+      newChunks[i] = new chunk_t;
+      newChunks[i]->size = chunkEntries;
+      ::memcpy(newChunks[i]->entries,
+               entries + offset,
+               chunkEntries * sizeof(entry_t));
+      offset += chunkEntries;
+    }
+
+    snapshot_t *newSnapshot = new snapshot_t;
+    newSnapshot->entryCount = ((oldSnapshot ? oldSnapshot->entryCount : 0)
+                               + entryDelta);
+    newSnapshot->chunkCount = (oldChunkCount
+                               - ((chunkIndex >= 0) ? 1 : 0)
+                               + newChunkCount);
+    newSnapshot->chunks = new chunk_t*[newSnapshot->chunkCount + 1];
+
+    // Untouched chunks are shared with the previous snapshot
+    chunk_t **chunks = newSnapshot->chunks;
+    int c = 0;
+    for (int i = 0; i < chunkIndex; ++i) {
+      chunks[c++] = oldSnapshot->chunks[i];
+    }
+    for (int i = 0; i < newChunkCount; ++i) {
+      chunks[c++] = newChunks[i];
+    }
+    for (int i = (chunkIndex + 1); i < oldChunkCount; ++i) {
+      chunks[c++] = oldSnapshot->chunks[i];
+    }
+
+    __atomic_store_n(&snapshot, newSnapshot, __ATOMIC_SEQ_CST);
+
+    if (chunkIndex >= 0) {
+      retired.chunks.push_back(oldSnapshot->chunks[chunkIndex]);
+    }
+    if (oldSnapshot) {
+      retired.snapshots.push_back(oldSnapshot);
+    }
+    reclaim();
+  }
+
+  void uvaIndex::reclaim() {
+    // Lookups from the previous epoch may still use [pending]
+    const int previousParity = ((epoch + 1) & 1);
+    if (!pending.isEmpty()) {
+      if (hasReaders(previousParity)) {
+        return;
+      }
+      pending.free();
+    }
+    if (retired.isEmpty()) {
+      return;
+    }
+
+    // Lookups starting in the new epoch only see the new snapshot,
+    //   so [pending] is freed once the current readers leave
+    pending.swap(retired);
+    __atomic_add_fetch(&epoch, 1, __ATOMIC_SEQ_CST);
+    if (!hasReaders(previousParity ^ 1)) {
+      pending.free();
+    }
+  }
+  //====================================
+
+
+  //---[ UVA ]--------------------------
+  occa::modeMemory_t* uvaToMemory(void *ptr) {
+    return uvaMap.find(ptr);
   }
 
   bool isManaged(void *ptr) {
@@ -159,12 +484,12 @@ namespace occa {
   }
 
   void removeFromStaleMap(void *ptr) {
-    ptrRangeMap::iterator it = uvaMap.find(ptr);
-    if (it == uvaMap.end()) {
+    occa::modeMemory_t *mem = uvaMap.find(ptr);
+    if (!mem) {
       return;
     }
 
-    memory m(it->second);
+    memory m(mem);
     if (!m.uvaIsStale()) {
       return;
     }
@@ -173,19 +498,8 @@ namespace occa {
   }
 
   void removeFromStaleMap(modeMemory_t *mem) {
-    if (!mem) {
-      return;
-    }
-
-    occa::memory m(mem);
-    const size_t staleEntries = uvaStaleMemory.size();
-
-    for (size_t i = 0; i < staleEntries; ++i) {
-      if (uvaStaleMemory[i] == mem) {
-        m.uvaMarkFresh();
-        uvaStaleMemory.erase(uvaStaleMemory.begin() + i);
-        break;
-      }
+    if (mem && mem->modeDevice) {
+      mem->modeDevice->removeStaleMemory(mem);
     }
   }
 
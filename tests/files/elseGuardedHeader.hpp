@@ -0,0 +1,6 @@
+#ifndef OCCA_TEST_ELSE_GUARDED_HEADER
+#define OCCA_TEST_ELSE_GUARDED_HEADER
+10
+#else
+11
+#endif
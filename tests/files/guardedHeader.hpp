@@ -0,0 +1,4 @@
+#ifndef OCCA_TEST_GUARDED_HEADER
+#define OCCA_TEST_GUARDED_HEADER
+5 6
+#endif
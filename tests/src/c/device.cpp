@@ -249,7 +249,7 @@ void testStreamMethods() {
   occaDeviceSetStream(device, cStream);
 
   ASSERT_EQ(stream.getModeStream(),
-            occa::getStream().getModeStream());
+            occa::c::device(device).getStream().getModeStream());
 
   ASSERT_EQ(stream.getModeStream(),
             occa::c::stream(occaDeviceGetStream(device)).getModeStream());
@@ -0,0 +1,153 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/tools/testing.hpp>
+
+#include <occa.hpp>
+
+const std::string addVectorsFile = (
+  occa::env::OCCA_DIR + "tests/files/addVectors.okl"
+);
+
+void testBuild();
+void testErrors();
+void testSettings();
+void testFreeDevice();
+
+int main(const int argc, const char **argv) {
+  testBuild();
+  testErrors();
+  testSettings();
+  testFreeDevice();
+
+  return 0;
+}
+
+void testBuild() {
+  occa::device device("mode: 'Serial'");
+
+  // Different defines give different binaries
+  std::vector<occa::kernelFuture> futures;
+  for (int i = 0; i < 4; ++i) {
+    occa::properties props;
+    props["defines/FUTURE_TEST"] = i;
+    futures.push_back(
+      device.buildKernelAsync(addVectorsFile, "addVectors", props)
+    );
+  }
+  ASSERT_TRUE(futures[0].isInitialized());
+  ASSERT_FALSE(occa::kernelFuture().isInitialized());
+
+  for (int i = 0; i < 4; ++i) {
+    futures[i].wait();
+    ASSERT_TRUE(futures[i].isReady());
+  }
+
+  occa::kernel addVectors = futures[3].get();
+  ASSERT_TRUE(addVectors.isInitialized());
+  ASSERT_EQ(futures[3].get().getModeKernel(),
+            addVectors.getModeKernel());
+
+  // Loaded through the device cache
+  occa::properties props;
+  props["defines/FUTURE_TEST"] = 3;
+  ASSERT_EQ(device.buildKernel(addVectorsFile, "addVectors", props).getModeKernel(),
+            addVectors.getModeKernel());
+
+  const int entries = 5;
+  float a[entries], b[entries], ab[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = i;
+    b[i] = 1 - i;
+  }
+  occa::memory o_a = device.malloc(entries * sizeof(float), a);
+  occa::memory o_b = device.malloc(entries * sizeof(float), b);
+  occa::memory o_ab = device.malloc(entries * sizeof(float));
+
+  addVectors(entries, o_a, o_b, o_ab);
+  o_ab.copyTo(ab);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], 1.0f);
+  }
+}
+
+void testErrors() {
+  occa::device device("mode: 'Serial'");
+
+  // Errors are thrown when the kernel is requested
+  occa::kernelFuture future = device.buildKernelAsync(
+    occa::env::OCCA_DIR + "tests/files/missingKernel.okl",
+    "addVectors"
+  );
+  future.wait();
+  ASSERT_TRUE(future.isReady());
+
+  ASSERT_THROW(
+    future.get();
+  );
+}
+
+void testSettings() {
+  occa::device device("mode: 'Serial'");
+
+  // The device hash depends on the settings version, which changes
+  //   the cache directory kernels are built in
+  occa::json &version = occa::settings()["version"];
+  const std::string baseVersion = version;
+  version = baseVersion + "-future-" + occa::toString(occa::sys::currentTime());
+
+  occa::kernelFuture future = device.buildKernelAsync(addVectorsFile,
+                                                      "addVectors");
+  future.wait();
+
+  // The worker built the kernel with the caller's settings,
+  //   so no other build is needed
+  const int cachedBuilds = (int) occa::io::directories(occa::io::cachePath()).size();
+  occa::kernel addVectors = future.get();
+  ASSERT_TRUE(addVectors.isInitialized());
+  ASSERT_EQ(cachedBuilds,
+            (int) occa::io::directories(occa::io::cachePath()).size());
+
+  occa::settings()["version"] = baseVersion;
+}
+
+void testFreeDevice() {
+  occa::device device("mode: 'Serial'");
+
+  // Freeing the device waits for running builds and cancels queued ones
+  std::vector<occa::kernelFuture> futures;
+  const std::string tag = occa::toString(occa::sys::currentTime());
+  for (int i = 0; i < 4; ++i) {
+    occa::properties props;
+    props["defines/FUTURE_FREE_TEST"] = tag + occa::toString(i);
+    futures.push_back(
+      device.buildKernelAsync(addVectorsFile, "addVectors", props)
+    );
+  }
+  device.free();
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(futures[i].isReady());
+    ASSERT_THROW(
+      futures[i].get();
+    );
+  }
+}
@@ -0,0 +1,200 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/tools/testing.hpp>
+
+#include <occa.hpp>
+
+const std::string addVectorsFile = (
+  occa::env::OCCA_DIR + "tests/files/addVectors.okl"
+);
+
+void testCapture();
+void testReplay();
+void testBarrier();
+void testRefs();
+
+int main(const int argc, const char **argv) {
+  testCapture();
+  testReplay();
+  testBarrier();
+  testRefs();
+
+  return 0;
+}
+
+void testCapture() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addVectors = device.buildKernel(addVectorsFile,
+                                               "addVectors");
+  const int entries = 8;
+  float a[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = i;
+  }
+  occa::memory o_a = device.malloc(entries * sizeof(float));
+  occa::memory o_b = device.malloc(entries * sizeof(float));
+
+  ASSERT_FALSE(device.isCapturing());
+  device.beginCapture();
+  ASSERT_TRUE(device.isCapturing());
+  ASSERT_THROW(
+    device.beginCapture();
+  );
+
+  // Nothing runs while capturing
+  o_a.copyFrom(a);
+  addVectors(entries, o_a, o_a, o_b);
+
+  occa::graph graph = device.endCapture();
+  ASSERT_FALSE(device.isCapturing());
+  ASSERT_THROW(
+    device.endCapture();
+  );
+
+  ASSERT_EQ(graph.size(), 2);
+  ASSERT_EQ(graph.levels(), 2);
+
+  float b[entries];
+  o_b.copyTo(b);
+  graph.run();
+  device.finish();
+  o_b.copyTo(b);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(b[i], 2.0f * i);
+  }
+
+  graph.free();
+  ASSERT_FALSE(graph.isInitialized());
+}
+
+void testReplay() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addVectors = device.buildKernel(addVectorsFile,
+                                               "addVectors");
+  const int entries = 64;
+  float a[entries], d[entries];
+  occa::memory o_a = device.malloc(entries * sizeof(float));
+  occa::memory o_b = device.malloc(entries * sizeof(float));
+  occa::memory o_c = device.malloc(entries * sizeof(float));
+  occa::memory o_d = device.malloc(entries * sizeof(float));
+
+  device.beginCapture();
+  o_a.copyFrom(a);
+  // b and c only read a, so they can run side by side
+  addVectors(entries, o_a, o_a, o_b);
+  addVectors(entries, o_a, o_a, o_c);
+  addVectors(entries, o_b, o_c, o_d);
+  o_d.copyTo(d);
+  occa::graph graph = device.endCapture();
+
+  ASSERT_EQ(graph.size(), 5);
+  ASSERT_EQ(graph.levels(), 4);
+  ASSERT_EQ(graph.getModeGraph()->levels[1].size(),
+            (size_t) 2);
+
+  // Host buffers are read when the graph runs, not when captured
+  for (int step = 0; step < 3; ++step) {
+    for (int i = 0; i < entries; ++i) {
+      a[i] = i + step;
+    }
+    graph.run();
+    device.finish();
+    for (int i = 0; i < entries; ++i) {
+      ASSERT_EQ(d[i], 4.0f * (i + step));
+    }
+  }
+
+  graph.free();
+}
+
+void testBarrier() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addVectors = device.buildKernel(addVectorsFile,
+                                               "addVectors");
+  const int entries = 8;
+  occa::memory o_a = device.malloc(entries * sizeof(float));
+  occa::memory o_b = device.malloc(entries * sizeof(float));
+  occa::memory o_c = device.malloc(entries * sizeof(float));
+
+  device.beginCapture();
+  addVectors(entries, o_a, o_a, o_b);
+  device.tagStream();
+  addVectors(entries, o_a, o_a, o_c);
+  occa::graph graph = device.endCapture();
+
+  // Tags order independent launches
+  ASSERT_EQ(graph.size(), 3);
+  ASSERT_EQ(graph.levels(), 3);
+
+  graph.free();
+}
+
+void testRefs() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addVectors = device.buildKernel(addVectorsFile,
+                                               "addVectors");
+  const int entries = 8;
+  occa::memory o_a = device.malloc(entries * sizeof(float));
+  occa::memory o_b = device.malloc(entries * sizeof(float));
+  occa::memory o_c = device.malloc(entries * sizeof(float));
+
+  device.beginCapture();
+  addVectors(entries, o_a, o_a, o_b);
+  addVectors(entries, o_a, o_a, o_c);
+  occa::graph graph = device.endCapture();
+
+  // Freeing a graph clears every copy
+  occa::graph graphCopy = graph;
+  ASSERT_EQ(graphCopy.getModeGraph(),
+            graph.getModeGraph());
+  graph.free();
+  ASSERT_FALSE(graph.isInitialized());
+  ASSERT_FALSE(graphCopy.isInitialized());
+  ASSERT_THROW(
+    graphCopy.run();
+  );
+
+  // The last wrapper going out of scope frees the graph
+  const int streamCount = (int) device.getModeDevice()->streams.size();
+  {
+    device.beginCapture();
+    addVectors(entries, o_a, o_a, o_b);
+    addVectors(entries, o_a, o_a, o_c);
+    occa::graph scopedGraph = device.endCapture();
+    ASSERT_EQ((int) device.getModeDevice()->streams.size(),
+              streamCount + 2);
+  }
+  ASSERT_EQ((int) device.getModeDevice()->streams.size(),
+            streamCount);
+  ASSERT_EQ(device.getModeDevice()->graphRing.head,
+            (occa::gc::ringEntry_t*) NULL);
+
+  // Graphs don't outlive their device
+  device.beginCapture();
+  addVectors(entries, o_a, o_a, o_b);
+  addVectors(entries, o_a, o_a, o_c);
+  graph = device.endCapture();
+  graphCopy = graph;
+  device.free();
+  ASSERT_FALSE(graph.isInitialized());
+  ASSERT_FALSE(graphCopy.isInitialized());
+}
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include <occa.hpp>
 #include <occa/io.hpp>
 #include <occa/tools/env.hpp>
 #include <occa/tools/testing.hpp>
@@ -29,6 +30,8 @@
 void testCacheInfoMethods();
 void testHashDir();
 void testBuild();
+void testDependencies();
+void testLoadStaleKernels();
 
 int main(const int argc, const char **argv) {
   occa::env::OCCA_CACHE_DIR = occa::io::dirname(__FILE__);
@@ -37,9 +40,15 @@ int main(const int argc, const char **argv) {
   testCacheInfoMethods();
   testHashDir();
   testBuild();
+  testDependencies();
+  testLoadStaleKernels();
 
   occa::sys::rmdir(occa::env::OCCA_CACHE_DIR + "locks",
                    true);
+  occa::sys::rmdir(occa::env::OCCA_CACHE_DIR + "sources/",
+                   true);
+  occa::sys::rmdir(occa::io::cachePath(),
+                   true);
 
   return 0;
 }
@@ -142,3 +151,100 @@ void testBuild() {
 
   occa::sys::rmrf("build.json");
 }
+
+void testDependencies() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+  const std::string hashDir = occa::io::hashDir(hash);
+  const std::string buildFile = hashDir + occa::kc::buildFile;
+  const std::string sourceFile = hashDir + "string_source.cpp";
+  const std::string binaryFile = hashDir + occa::kc::binaryFile;
+  const std::string header = hashDir + "headers/dependency.hpp";
+
+  occa::io::write(sourceFile, "source");
+  occa::io::write(binaryFile, "binary");
+  occa::io::write(header, "1");
+
+  // No build file, nothing to check
+  ASSERT_FALSE(occa::io::dependenciesChanged(buildFile));
+
+  occa::properties props;
+  occa::strVector dependencies;
+  dependencies.push_back(header);
+  occa::io::setDependencyProps(props["dependencies"], dependencies);
+  props.write(buildFile);
+
+  ASSERT_EQ(props["dependencies"].size(),
+            1);
+  ASSERT_EQ((std::string) props["dependencies"][0]["file"],
+            header);
+  ASSERT_FALSE(occa::io::dependenciesChanged(buildFile));
+
+  // Same contents with a new modified time
+  occa::io::write(header, "1");
+  ASSERT_FALSE(occa::io::dependenciesChanged(buildFile));
+
+  // Stale builds keep their source
+  occa::io::write(header, "22");
+  ASSERT_TRUE(occa::io::dependenciesChanged(buildFile));
+
+  occa::io::removeStaleBuild(sourceFile, hashDir, hash);
+  ASSERT_TRUE(occa::io::isFile(sourceFile));
+  ASSERT_FALSE(occa::io::isFile(buildFile));
+  ASSERT_FALSE(occa::io::isFile(binaryFile));
+  ASSERT_FALSE(occa::io::isFile(header));
+
+  // Missing dependencies are also stale
+  props.write(buildFile);
+  ASSERT_TRUE(occa::io::dependenciesChanged(buildFile));
+}
+
+int readHeaderValue(const std::string &kernelFile,
+                    const bool loadKernels) {
+  occa::device device("mode: 'Serial'");
+  if (loadKernels) {
+    device.loadKernels();
+  }
+
+  occa::kernel readValue = device.buildKernel(kernelFile,
+                                              "readValue");
+  int value = 0;
+  occa::memory o_value = device.malloc(sizeof(int), &value);
+  readValue(o_value);
+  o_value.copyTo(&value);
+  return value;
+}
+
+void testLoadStaleKernels() {
+  // Files inside the cache path are treated as cached kernel sources
+  const std::string sourceDir = occa::env::OCCA_CACHE_DIR + "sources/";
+  const std::string header = sourceDir + "value.hpp";
+  const std::string kernelFile = sourceDir + "readValue.okl";
+
+  occa::io::write(header, "// value\n#define VAL 1\n");
+  occa::io::write(
+    kernelFile,
+    "#include \"" + header + "\"\n"
+    "\n"
+    "@kernel void readValue(int *value) {\n"
+    "  for (int i = 0; i < 1; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {\n"
+    "      value[0] = VAL;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+
+  ASSERT_EQ(readHeaderValue(kernelFile, false),
+            1);
+
+  occa::io::write(header, "// value\n#define VAL 2\n");
+  ASSERT_EQ(readHeaderValue(kernelFile, false),
+            2);
+
+  // Preloaded kernels must not bypass the dependency check
+  occa::io::write(header, "// value\n#define VAL 3\n");
+  ASSERT_EQ(readHeaderValue(kernelFile, true),
+            3);
+  ASSERT_EQ(readHeaderValue(kernelFile, true),
+            3);
+}
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <unistd.h>
+#include <sys/wait.h>
 
 #include <occa/io.hpp>
 #include <occa/tools/env.hpp>
@@ -30,6 +31,7 @@
 void testInit();
 void testAutoRelease();
 void testStaleRelease();
+void testWakeupLatency();
 void clearLocks();
 
 int main(const int argc, const char **argv) {
@@ -44,6 +46,7 @@ int main(const int argc, const char **argv) {
   testInit();
   testAutoRelease();
   testStaleRelease();
+  testWakeupLatency();
 
   clearLocks();
 
@@ -60,21 +63,21 @@ void testAutoRelease() {
 
   occa::io::lock_t lock1(hash, "tag");
   ASSERT_TRUE(lock1.isInitialized());
-  ASSERT_EQ(lock1.dir(),
+  ASSERT_EQ(lock1.file(),
             occa::env::OCCA_CACHE_DIR
             + "locks/"
             + hash.toString()
             + "_tag");
   ASSERT_TRUE(lock1.isMine());
 
-  ASSERT_TRUE(occa::io::isDir(lock1.dir()));
+  ASSERT_TRUE(occa::io::isFile(lock1.file()));
 
   occa::io::lock_t lock2(hash, "tag");
   ASSERT_TRUE(lock2.isMine());
 
-  ASSERT_TRUE(occa::io::isDir(lock2.dir()));
+  ASSERT_TRUE(occa::io::isFile(lock2.file()));
   lock2.release();
-  ASSERT_FALSE(occa::io::isDir(lock2.dir()));
+  ASSERT_FALSE(occa::io::isFile(lock2.file()));
 }
 
 void testStaleRelease() {
@@ -99,7 +102,67 @@ void testStaleRelease() {
   lock2.release();
   lock3.release();
 
-  ASSERT_FALSE(occa::io::isDir(lock1.dir()));
+  ASSERT_FALSE(occa::io::isFile(lock1.file()));
+}
+
+void testWakeupLatency() {
+  const int processes = 32;
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  // Use a long stale age so waiters only wake up on release
+  occa::io::lock_t lock(hash, "latency", 60);
+  ASSERT_TRUE(lock.isMine());
+
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+
+  for (int i = 0; i < processes; ++i) {
+    if (::fork() == 0) {
+      ::close(fds[0]);
+      occa::io::lock_t childLock(hash, "latency", 60);
+      // The parent does the work, children should skip it
+      const bool isMine = childLock.isMine();
+      const double wakeupTime = (isMine
+                                 ? -1.0
+                                 : occa::sys::currentTime());
+      ssize_t written = ::write(fds[1], &wakeupTime, sizeof(double));
+      ::_exit(written != sizeof(double));
+    }
+  }
+  ::close(fds[1]);
+
+  // Give every process time to start waiting
+  ::usleep(500000);
+
+  const double releaseTime = occa::sys::currentTime();
+  lock.release();
+
+  double maxLatency = 0;
+  double totalLatency = 0;
+  for (int i = 0; i < processes; ++i) {
+    double wakeupTime = -1;
+    ASSERT_EQ((int) ::read(fds[0], &wakeupTime, sizeof(double)),
+              (int) sizeof(double));
+    ASSERT_GE(wakeupTime, 0);
+
+    const double latency = wakeupTime - releaseTime;
+    maxLatency = std::max(maxLatency, latency);
+    totalLatency += latency;
+  }
+  ::close(fds[0]);
+
+  for (int i = 0; i < processes; ++i) {
+    int status;
+    ::wait(&status);
+    ASSERT_EQ(status, 0);
+  }
+
+  std::cout << "Lock wake-up latency for " << processes << " processes:\n"
+            << "  average: " << (1000 * totalLatency / processes) << " ms\n"
+            << "  max    : " << (1000 * maxLatency) << " ms\n";
+
+  // Waiters used to poll every 0.5 seconds
+  ASSERT_LT(maxLatency, 0.25);
 }
 
 void clearLocks() {
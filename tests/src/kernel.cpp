@@ -32,6 +32,11 @@ void testInfo();
 void testParsingFailure();
 void testCompilingFailure();
 void testRun();
+void testCache();
+void testLoadKernels();
+void testBind();
+void testBatch();
+void testSpecialize();
 
 int main(const int argc, const char **argv) {
   addVectors = occa::buildKernel(addVectorsFile,
@@ -42,6 +47,11 @@ int main(const int argc, const char **argv) {
   testParsingFailure();
   testCompilingFailure();
   testRun();
+  testCache();
+  testLoadKernels();
+  testBind();
+  testBatch();
+  testSpecialize();
 
   return 0;
 }
@@ -174,3 +184,293 @@ void testRun() {
 
   occa::freeUvaPtr(uvaPtr);
 }
+
+void testCache() {
+  occa::kernel kernel1 = occa::buildKernel(addVectorsFile,
+                                           "addVectors");
+  occa::kernel kernel2 = occa::buildKernel(addVectorsFile,
+                                           "addVectors");
+  ASSERT_TRUE(kernel1 == kernel2);
+
+  // Different properties build a different kernel
+  occa::kernel kernel3 = occa::buildKernel(addVectorsFile,
+                                           "addVectors",
+                                           "defines: { FOO: 1 }");
+  ASSERT_TRUE(kernel1 != kernel3);
+
+  // Freed kernels are dropped from the cache
+  kernel1.free();
+  ASSERT_FALSE(kernel2.isInitialized());
+
+  kernel1 = occa::buildKernel(addVectorsFile,
+                              "addVectors");
+  ASSERT_TRUE(kernel1.isInitialized());
+
+  // The cache keeps kernels alive after the last user reference
+  occa::modeKernel_t *modeKernel = kernel1.getModeKernel();
+  kernel1 = occa::kernel();
+  kernel1 = occa::buildKernel(addVectorsFile,
+                              "addVectors");
+  ASSERT_EQ((void*) kernel1.getModeKernel(),
+            (void*) modeKernel);
+}
+
+void testLoadKernels() {
+  occa::device device1("mode: 'Serial'");
+  occa::kernel kernel1 = device1.buildKernel(addVectorsFile,
+                                             "addVectors");
+
+  // A fresh device picks up the binary without rebuilding it
+  occa::device device2("mode: 'Serial'");
+  device2.loadKernels();
+
+  occa::kernel kernel2 = device2.buildKernel(addVectorsFile,
+                                             "addVectors");
+  ASSERT_TRUE(kernel1 != kernel2);
+  ASSERT_EQ(kernel2.binaryFilename(),
+            kernel1.binaryFilename());
+  ASSERT_EQ(kernel2.sourceFilename(),
+            occa::io::dirname(kernel1.binaryFilename()) + occa::kc::sourceFile);
+  ASSERT_EQ(kernel2.getModeKernel()->metadata.name,
+            "addVectors");
+
+  // Loading again reuses the kernels already loaded
+  device2.loadKernels();
+  ASSERT_EQ((void*) device2.buildKernel(addVectorsFile,
+                                        "addVectors").getModeKernel(),
+            (void*) kernel2.getModeKernel());
+}
+
+void testBind() {
+  occa::kernel addVectors = occa::buildKernel(addVectorsFile,
+                                              "addVectors");
+
+  const int entries = 8;
+  float a[entries], b[entries], ab[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i]  = i;
+    b[i]  = 1 - i;
+    ab[i] = 0;
+  }
+  occa::memory o_a  = occa::malloc(entries * sizeof(float), a);
+  occa::memory o_b  = occa::malloc(entries * sizeof(float), b);
+  occa::memory o_ab = occa::malloc(entries * sizeof(float));
+
+  occa::kernelFrame frame = addVectors.bind(entries, o_a, o_b, o_ab);
+  ASSERT_TRUE(frame.isInitialized());
+  ASSERT_EQ(frame.argumentCount(), 4);
+
+  frame.run();
+  o_ab.copyTo(ab);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], 1.0f);
+  }
+
+  // Only update the changed argument
+  frame.setArg(2, o_a).run();
+  o_ab.copyTo(ab);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], 2.0f * i);
+  }
+
+  ASSERT_THROW(
+    frame.setArg(4, o_a);
+  );
+
+  // Frames keep their own copy of arguments passed by value
+  occa::kernel addOffset = occa::buildKernelFromString(
+    "@kernel void addOffset(const int entries, const float2 offset, float *ab) {\n"
+    "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+    "    ab[i] = offset.x + offset.y;\n"
+    "  }\n"
+    "}\n",
+    "addOffset"
+  );
+  occa::kernelFrame offsetFrame;
+  {
+    occa::float2 offset(1, 2);
+    occa::kernelFrame scopedFrame = addOffset.bind(entries, offset, o_ab);
+    offset.x = 100;
+    offsetFrame = scopedFrame;
+    scopedFrame.setArg(1, offset);
+    offset.y = 100;
+  }
+  for (int run = 0; run < 2; ++run) {
+    offsetFrame.run();
+    o_ab.copyTo(ab);
+    for (int i = 0; i < entries; ++i) {
+      ASSERT_EQ(ab[i], 3.0f);
+    }
+  }
+
+  // Frames leave the kernel's own argument list alone
+  addVectors(entries, o_a, o_b, o_ab);
+  frame.run();
+  ASSERT_EQ(addVectors.getModeKernel()->argumentCount(), 4);
+
+  const int launches = 100000;
+  double start = occa::sys::currentTime();
+  for (int i = 0; i < launches; ++i) {
+    addVectors(0, o_a, o_b, o_ab);
+  }
+  const double operatorTime = occa::sys::currentTime() - start;
+
+  frame.setArg(0, 0);
+  start = occa::sys::currentTime();
+  for (int i = 0; i < launches; ++i) {
+    frame.run();
+  }
+  const double frameTime = occa::sys::currentTime() - start;
+
+  // Keep the stream busy so every launch is queued behind running work
+  occa::kernel spin = occa::buildKernelFromString(
+    "@kernel void spin(const int iterations, int *result) {\n"
+    "  for (int i = 0; i < 1; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {\n"
+    "      volatile int value = 0;\n"
+    "      for (int k = 0; k < iterations; ++k) {\n"
+    "        value = value + 1;\n"
+    "      }\n"
+    "      result[0] = value;\n"
+    "    }\n"
+    "  }\n"
+    "}\n",
+    "spin"
+  );
+  occa::memory o_result = occa::malloc(sizeof(int));
+  occa::finish();
+  spin(100000000, o_result);
+  start = occa::sys::currentTime();
+  for (int i = 0; i < launches; ++i) {
+    addVectors(0, o_a, o_b, o_ab);
+  }
+  const double busyTime = occa::sys::currentTime() - start;
+  occa::finish();
+
+  std::cout << "Launch overhead:\n"
+            << "  operator(): " << (1e9 * operatorTime / launches) << " ns\n"
+            << "  frame     : " << (1e9 * frameTime / launches) << " ns\n"
+            << "  busy      : " << (1e9 * busyTime / launches) << " ns\n";
+}
+
+void testBatch() {
+  std::string source = (
+    "@kernel void scale(const int N, const float a, float *x) {\n"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+    "    x[i] *= a;\n"
+    "  }\n"
+    "}\n"
+    "@kernel void accumulate(const int N, const float *x, float *y) {\n"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+    "    y[i] += x[i];\n"
+    "  }\n"
+    "}\n"
+  );
+  occa::kernel scale = occa::buildKernelFromString(source, "scale");
+  occa::kernel accumulate = occa::buildKernelFromString(source, "accumulate");
+
+  const int entries = 40;
+  float x[entries], y[entries];
+  for (int i = 0; i < entries; ++i) {
+    x[i] = i;
+    y[i] = 1;
+  }
+  occa::memory o_x = occa::malloc(entries * sizeof(float), x);
+  occa::memory o_y = occa::malloc(entries * sizeof(float), y);
+
+  occa::kernelBatch batch;
+  batch
+    .add(scale.bind(entries, 2.0f, o_x))
+    .add(accumulate.bind(entries, o_x, o_y));
+  ASSERT_EQ(batch.size(), 2);
+  ASSERT_TRUE(batch.canFuse());
+
+  occa::kernel fused = batch.getFusedKernel();
+  ASSERT_TRUE(fused.isInitialized());
+  ASSERT_EQ(fused.name(),
+            "_occa_fused_scale_accumulate");
+
+  batch.run();
+  o_y.copyTo(y);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(y[i], 1.0f + 2.0f * i);
+  }
+
+  // Mismatched loop bounds run the kernels one at a time
+  batch.clear();
+  batch
+    .add(scale.bind(entries, 0.5f, o_x))
+    .add(accumulate.bind(entries / 2, o_x, o_y));
+  std::vector<const occa::kernelArg*> args;
+  ASSERT_FALSE(batch.getFusedArguments(batch.getFusedKernel(), args));
+
+  batch.run();
+  o_y.copyTo(y);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(y[i], (i < (entries / 2)) ? (1.0f + 3.0f * i) : (1.0f + 2.0f * i));
+  }
+
+  // Overlapping buffers can't be fused
+  batch.clear();
+  batch
+    .add(scale.bind(entries - 1, 1.0f, o_x + 1))
+    .add(accumulate.bind(entries - 1, o_x, o_y));
+  ASSERT_FALSE(batch.canFuse());
+
+  // Kernels with the same names from another source aren't fused
+  //   with the cached kernel
+  source.replace(source.find("x[i] *= a"), 9, "x[i] += a");
+  occa::kernel shift = occa::buildKernelFromString(source, "scale");
+  occa::kernel shiftAccumulate = occa::buildKernelFromString(source, "accumulate");
+
+  for (int i = 0; i < entries; ++i) {
+    x[i] = i;
+    y[i] = 1;
+  }
+  o_x.copyFrom(x);
+  o_y.copyFrom(y);
+
+  batch.clear();
+  batch
+    .add(shift.bind(entries, 2.0f, o_x))
+    .add(shiftAccumulate.bind(entries, o_x, o_y));
+  ASSERT_TRUE(batch.canFuse());
+  ASSERT_TRUE(batch.getFusedKernel() != fused);
+
+  batch.run();
+  o_y.copyTo(y);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(y[i], 3.0f + i);
+  }
+}
+
+void testSpecialize() {
+  const int entries = 40;
+  float a[entries], b[entries], ab[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = i;
+    b[i] = 1 - i;
+    ab[i] = 0;
+  }
+  occa::memory o_a  = occa::malloc(entries * sizeof(float), a);
+  occa::memory o_b  = occa::malloc(entries * sizeof(float), b);
+  occa::memory o_ab = occa::malloc(entries * sizeof(float), ab);
+
+  occa::kernel addVectors2 = occa::buildKernel(addVectorsFile,
+                                               "addVectors");
+  occa::kernel specialized = addVectors2.specialize("entries", entries);
+  ASSERT_TRUE(specialized.isInitialized());
+  ASSERT_TRUE(specialized != addVectors2);
+  ASSERT_EQ((int) specialized.properties()["okl/specialize/entries"],
+            entries);
+
+  // entries is no longer an argument
+  specialized(o_a, o_b, o_ab);
+  o_ab.copyTo(ab);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], 1.0f);
+  }
+
+  // Same specialization reuses the cached kernel
+  ASSERT_TRUE(addVectors2.specialize("entries", entries) == specialized);
+}
@@ -0,0 +1,130 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/defines.hpp>
+#include <occa/tools/testing.hpp>
+#include <occa/lang/arena.hpp>
+#include <occa/lang/token.hpp>
+
+using namespace occa::lang;
+
+void testReuse();
+void testLargeBlocks();
+void testRelease();
+void testTokens();
+
+int main(const int argc, const char **argv) {
+  testReuse();
+  testLargeBlocks();
+  testRelease();
+  testTokens();
+
+  return 0;
+}
+
+void testReuse() {
+  arena_t arena;
+
+  void *a = arena.alloc(24);
+  void *b = arena.alloc(24);
+  ASSERT_NEQ(a, b);
+  ASSERT_EQ(0, (int) (((size_t) a) % arena_t::alignment));
+  ASSERT_EQ(0, (int) (((size_t) b) % arena_t::alignment));
+  ASSERT_EQ(arena_t::slabBytes, arena.bytesReserved());
+
+  // Freed blocks are reused by allocations in the same size class
+  arena.free(a, 24);
+  ASSERT_EQ(a, arena.alloc(32));
+
+  arena.free(b, 24);
+  void *c = arena.alloc(48);
+  ASSERT_NEQ(b, c);
+
+  arena.free(a, 32);
+  arena.free(c, 48);
+}
+
+void testLargeBlocks() {
+  arena_t arena;
+
+  // Large objects skip the slabs
+  void *ptr = arena.alloc(arena_t::maxBytes + 1);
+  ASSERT_EQ(0, (int) arena.bytesReserved());
+  arena.free(ptr, arena_t::maxBytes + 1);
+
+  // New slabs are started once the current one is used up
+  const int blocks = (int) (arena_t::slabBytes / arena_t::maxBytes);
+  for (int i = 0; i <= blocks; ++i) {
+    arena.alloc(arena_t::maxBytes);
+  }
+  ASSERT_EQ(2 * arena_t::slabBytes, arena.bytesReserved());
+}
+
+void testRelease() {
+  arena_t arena;
+  arena_t otherArena;
+
+  const int blocks = (int) (2 * arena_t::slabBytes / arena_t::maxBytes);
+  std::vector<void*> ptrs;
+  for (int i = 0; i < blocks; ++i) {
+    ptrs.push_back(arena.alloc(arena_t::maxBytes));
+  }
+  ASSERT_EQ(3 * arena_t::slabBytes, arena.bytesReserved());
+
+  // Only one slab is kept once every block is freed
+  for (int i = 0; i < blocks; ++i) {
+    arena.free(ptrs[i], arena_t::maxBytes);
+  }
+  ASSERT_EQ(arena_t::slabBytes, arena.bytesReserved());
+
+  // Blocks freed through another arena go back to their owner
+  void *a = arena.alloc(24);
+  void *b = arena.alloc(24);
+  otherArena.free(a, 24);
+  ASSERT_EQ(0, (int) otherArena.bytesReserved());
+
+  arena.release();
+  ASSERT_EQ(arena_t::slabBytes, arena.bytesReserved());
+
+  otherArena.free(b, 24);
+  arena.release();
+  ASSERT_EQ(0, (int) arena.bytesReserved());
+
+  // Released arenas start new slabs when used again
+  a = arena.alloc(24);
+  ASSERT_EQ(arena_t::slabBytes, arena.bytesReserved());
+  arena.free(a, 24);
+}
+
+void testTokens() {
+  occa::lang::fileOrigin origin;
+
+  token_t *token = new identifierToken(origin, "foo");
+  token_t *clone = token->clone();
+  ASSERT_EQ("foo", clone->to<identifierToken>().value);
+
+  delete token;
+  delete clone;
+
+  token = new identifierToken(origin, "bar");
+  ASSERT_EQ("bar", token->to<identifierToken>().value);
+  delete token;
+}
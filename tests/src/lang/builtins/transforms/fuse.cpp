@@ -0,0 +1,122 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include "../../parserUtils.hpp"
+#include <occa/lang/builtins/transforms/fuse.hpp>
+
+void testFuseNames();
+void testFuseLoops();
+void testFuseErrors();
+
+int main(const int argc, const char **argv) {
+  parser.addAttribute<attributes::kernel>();
+  parser.addAttribute<attributes::outer>();
+  parser.addAttribute<attributes::inner>();
+
+  testFuseNames();
+  testFuseLoops();
+  testFuseErrors();
+
+  return 0;
+}
+
+const std::string fuseSource = (
+  "@kernel void copy(const int N, const float *x, float *y) {\n"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+  "    y[i] = x[i];\n"
+  "  }\n"
+  "}\n"
+  "@kernel void axpy(const int N, const float a, const float *y, float *z) {\n"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+  "    z[i] += a * y[i];\n"
+  "  }\n"
+  "}\n"
+  "@kernel void shift(const int N, float *z) {\n"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+  "    z[i + 1] = z[i];\n"
+  "  }\n"
+  "}\n"
+);
+
+void fuseKernels(const std::string &names) {
+  parser.settings["okl/fuse"] = occa::json::parse(names);
+  parseSource(fuseSource);
+  parser.settings.remove("okl/fuse");
+}
+
+functionDeclStatement& getFusedKernel() {
+  return *((functionDeclStatement*) parser.root[parser.root.size() - 1]);
+}
+
+void testFuseNames() {
+  occa::strVector names;
+  names.push_back("copy");
+  names.push_back("axpy");
+
+  ASSERT_EQ("_occa_fused_copy_axpy",
+            transforms::kernelFuser::fusedKernelName(names));
+  ASSERT_EQ("x",
+            transforms::kernelFuser::fusedArgumentName(0, "x"));
+  ASSERT_EQ("_occa_fused2_x",
+            transforms::kernelFuser::fusedArgumentName(2, "x"));
+}
+
+void testFuseLoops() {
+  // Merged into one loop, N is shared
+  fuseKernels("['copy', 'axpy']");
+  ASSERT_TRUE(parser.success);
+  ASSERT_EQ(4,
+            parser.root.size());
+  {
+    functionDeclStatement &fusedSmnt = getFusedKernel();
+    function_t &func = fusedSmnt.function;
+    ASSERT_EQ("_occa_fused_copy_axpy",
+              func.name());
+    ASSERT_EQ(6,
+              (int) func.args.size());
+    ASSERT_EQ("_occa_fused1_a",
+              func.args[3]->name());
+    ASSERT_EQ("_occa_fused1_z",
+              func.args[5]->name());
+    ASSERT_EQ(1,
+              fusedSmnt.size());
+  }
+
+  // shift is not element-wise and runs after the merged loop
+  fuseKernels("['copy', 'axpy', 'shift']");
+  ASSERT_TRUE(parser.success);
+  {
+    functionDeclStatement &fusedSmnt = getFusedKernel();
+    function_t &func = fusedSmnt.function;
+    ASSERT_EQ(8,
+              (int) func.args.size());
+    ASSERT_EQ("_occa_fused2_N",
+              func.args[6]->name());
+    ASSERT_EQ(2,
+              fusedSmnt.size());
+  }
+}
+
+void testFuseErrors() {
+  std::cerr << "Testing fuse errors:\n";
+  fuseKernels("['copy', 'missing']");
+  ASSERT_FALSE(parser.success);
+}
@@ -0,0 +1,129 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include "../../parserUtils.hpp"
+#include <occa/lang/builtins/transforms/specialize.hpp>
+
+void testSpecializeArguments();
+void testSpecializeErrors();
+
+int main(const int argc, const char **argv) {
+  parser.addAttribute<attributes::kernel>();
+  parser.addAttribute<attributes::outer>();
+  parser.addAttribute<attributes::inner>();
+
+  testSpecializeArguments();
+  testSpecializeErrors();
+
+  return 0;
+}
+
+const std::string specializeSource = (
+  "@kernel void scale(const int N, const int T, const float a,\n"
+  "                   const float *x, float *y) {\n"
+  "  for (int i = 0; i < N; ++i; @tile(T, @outer, @inner)) {\n"
+  "    y[i] = a * x[i];\n"
+  "  }\n"
+  "}\n"
+);
+
+const std::string writeSource = (
+  "@kernel void scale(int N, float *y) {\n"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+  "    y[i] = N;\n"
+  "  }\n"
+  "  WRITE;\n"
+  "}\n"
+);
+
+void specializeKernel(const std::string &values,
+                      const std::string &source = specializeSource) {
+  parser.settings["okl/specialize"] = occa::json::parse(values);
+  parseSource(source);
+  parser.settings.remove("okl/specialize");
+}
+
+void specializeWrite(const std::string &write) {
+  std::string source = writeSource;
+  source.replace(source.find("WRITE"), 5, write);
+  specializeKernel("{ N: 8 }", source);
+}
+
+void testSpecializeArguments() {
+  specializeKernel("{ N: 64, T: 16, a: 0.5 }");
+  ASSERT_TRUE(parser.success);
+
+  functionDeclStatement &kernelSmnt = (
+    *((functionDeclStatement*) parser.root[0])
+  );
+  function_t &func = kernelSmnt.function;
+  ASSERT_EQ(2,
+            (int) func.args.size());
+  ASSERT_EQ("x",
+            func.args[0]->name());
+  ASSERT_EQ("y",
+            func.args[1]->name());
+
+  const std::string source = parser.toString();
+  ASSERT_NEQ(std::string::npos,
+             source.find("5.00000000e-01f * x[i]"));
+  ASSERT_EQ(std::string::npos,
+            source.find("a * x[i]"));
+
+  // Specialized arguments are not part of the metadata
+  kernelMetadataMap metadataMap;
+  parser.setMetadata(metadataMap);
+  ASSERT_EQ(2,
+            (int) metadataMap["scale"].arguments.size());
+
+  // Reading non-const arguments is fine
+  specializeWrite("y[0] = N + 1");
+  ASSERT_TRUE(parser.success);
+}
+
+void testSpecializeErrors() {
+  std::cerr << "Testing specialize errors:\n";
+  specializeKernel("{ x: 1 }");
+  ASSERT_FALSE(parser.success);
+
+  specializeKernel("{ N: 'foo' }");
+  ASSERT_FALSE(parser.success);
+
+  // Names matching no @kernel argument
+  specializeKernel("{ N: 64, M: 1 }");
+  ASSERT_FALSE(parser.success);
+
+  // Specialized arguments can't be written to
+  specializeWrite("N -= 1");
+  ASSERT_FALSE(parser.success);
+
+  specializeWrite("(N) = 1");
+  ASSERT_FALSE(parser.success);
+
+  specializeWrite("++N");
+  ASSERT_FALSE(parser.success);
+
+  specializeWrite("N--");
+  ASSERT_FALSE(parser.success);
+
+  specializeWrite("int *p = &N");
+  ASSERT_FALSE(parser.success);
+}
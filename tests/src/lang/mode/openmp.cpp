@@ -26,12 +26,18 @@
 #include "../parserUtils.hpp"
 
 void testPragma();
+void testCollapse();
+void testSimd();
+
+occa::strVector getPragmas();
 
 int main(const int argc, const char **argv) {
   parser.settings["okl/validate"] = false;
   parser.settings["serial/include-std"] = false;
 
   // testPragma();
+  testCollapse();
+  testSimd();
 
   return 0;
 }
@@ -57,3 +63,127 @@ void testPragma() {
             ompPragma.value());
 }
 //======================================
+
+//---[ Collapse ]-----------------------
+void testCollapse() {
+  // Nested @outer loops are collapsed
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 0; i < N; ++i; @outer) {\n"
+    "      for (int k = 0; k < N; ++k; @inner) {}\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  occa::strVector pragmas = getPragmas();
+  ASSERT_EQ(2,
+            (int) pragmas.size());
+  ASSERT_EQ("omp parallel for collapse(2)",
+            pragmas[0]);
+
+  // Dependent bounds are not collapsed
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = j; i < N; ++i; @outer) {\n"
+    "      for (int k = 0; k < N; ++k; @inner) {}\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  ASSERT_EQ("omp parallel for",
+            getPragmas()[0]);
+
+  // Schedule from the kernel properties
+  parser.settings["openmp/schedule"] = "dynamic, 4";
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < N; ++k; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  ASSERT_EQ("omp parallel for schedule(dynamic, 4)",
+            getPragmas()[0]);
+
+  parser.settings["openmp/schedule"] = "fastest";
+  parseBadSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < N; ++k; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+  parser.settings.remove("openmp/schedule");
+}
+//======================================
+
+//---[ Simd ]---------------------------
+void testSimd() {
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < N; ++k; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  occa::strVector pragmas = getPragmas();
+  ASSERT_EQ(2,
+            (int) pragmas.size());
+  ASSERT_EQ("omp simd",
+            pragmas[1]);
+
+  // Barriers keep @inner loops in order
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < N; ++k; @inner) {}\n"
+    "    @barrier(\"local\");\n"
+    "    for (int k = 0; k < N; ++k; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  ASSERT_EQ(1,
+            (int) getPragmas().size());
+
+  // Early exits can't be vectorized
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < N; ++k; @inner) {\n"
+    "      if (k == j) return;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  ASSERT_EQ(1,
+            (int) getPragmas().size());
+}
+//======================================
+
+occa::strVector getPragmas() {
+  statementPtrVector pragmaSmnts;
+  findStatementsByType(statementType::pragma,
+                       parser.root,
+                       pragmaSmnts);
+
+  occa::strVector pragmas;
+  const int count = (int) pragmaSmnts.size();
+  for (int i = 0; i < count; ++i) {
+    pragmas.push_back(pragmaSmnts[i]->to<pragmaStatement>().value());
+  }
+  return pragmas;
+}
@@ -28,6 +28,7 @@
 void testPreprocessor();
 void testKernel();
 void testExclusives();
+void testTrampoline();
 
 int main(const int argc, const char **argv) {
   parser.settings["serial/include-std"] = false;
@@ -39,6 +40,8 @@ int main(const int argc, const char **argv) {
   // parser.settings["okl/validate"] = true;
   // testExclusives();
 
+  testTrampoline();
+
   return 0;
 }
 
@@ -147,3 +150,38 @@ void testExclusives() {
   );
 }
 //======================================
+
+//---[ Trampoline ]---------------------
+void testTrampoline() {
+  parseSource(
+    "@kernel void foo(const int N, float *a, int b[4]) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {}\n"
+    "  }\n"
+    "}\n"
+    "@kernel void bar(const int N, const float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  // Kernels with array arguments keep the runFunction path
+  //   [#include <occa/mode/serial/runtime.hpp>, foo, bar, trampoline]
+  ASSERT_EQ(4,
+            (int) parser.root.size());
+
+  functionDeclStatement &trampoline = getStatement<functionDeclStatement>(3);
+  ASSERT_EQ(okl::serialParser::trampolinePrefix + "bar",
+            trampoline.function.name());
+  ASSERT_TRUE(trampoline.function.returnType.has(externC));
+
+  printer pout;
+  trampoline.print(pout);
+  const std::string output = pout.str();
+
+  ASSERT_TRUE(output.find("bar(*(const int *) _occa_args[0], "
+                          "(const float *) _occa_args[1]);") != std::string::npos);
+}
+//======================================
@@ -0,0 +1,161 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#define OCCA_TEST_PARSER_TYPE okl::threadsParser
+
+#include <occa/lang/mode/threads.hpp>
+#include "../parserUtils.hpp"
+
+void testThreadInfoArg();
+void testChunkedLoops();
+void testOuterStatementGuards();
+
+int main(const int argc, const char **argv) {
+  parser.settings["serial/include-std"] = false;
+
+  testThreadInfoArg();
+  testChunkedLoops();
+  testOuterStatementGuards();
+
+  return 0;
+}
+
+// Kernels are followed by their trampoline
+functionDeclStatement& getKernel() {
+  return getStatement<functionDeclStatement>(parser.root.size() - 2);
+}
+
+functionDeclStatement& getTrampoline() {
+  return getStatement<functionDeclStatement>(parser.root.size() - 1);
+}
+
+//---[ Thread Info ]--------------------
+void testThreadInfoArg() {
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  variablePtrVector &args = getKernel().function.args;
+  ASSERT_EQ(3,
+            (int) args.size());
+  ASSERT_EQ("N",
+            args[0]->name());
+  ASSERT_EQ(okl::threadsParser::threadInfoName,
+            args[2]->name());
+  ASSERT_TRUE(args[2]->vartype.isPointerType());
+
+  // The trampoline forwards the thread info
+  printer pout;
+  getTrampoline().print(pout);
+  ASSERT_TRUE(pout.str().find("(int *) _occa_args[2]") != std::string::npos);
+}
+//======================================
+
+//---[ Chunked Loops ]------------------
+void testChunkedLoops() {
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {}\n"
+    "  }\n"
+    "  for (int i = N; i > 0; i -= 2; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  // Each outer-most loop gets a size query before it
+  functionDeclStatement &foo = getKernel();
+  ASSERT_EQ(4,
+            foo.size());
+  ASSERT_EQ_BINARY(statementType::if_,
+                   foo[0]->type());
+  ASSERT_EQ_BINARY(statementType::for_,
+                   foo[1]->type());
+  ASSERT_EQ_BINARY(statementType::if_,
+                   foo[2]->type());
+  ASSERT_EQ_BINARY(statementType::for_,
+                   foo[3]->type());
+
+  printer pout;
+  foo.print(pout);
+  std::cout << pout.str();
+  const std::string output = pout.str();
+
+  ASSERT_TRUE(output.find("_occa_thread_info[0] == -1") != std::string::npos);
+  ASSERT_TRUE(output.find("_occa_thread_info[0] == -2") != std::string::npos);
+  ASSERT_TRUE(output.find("(_occa_thread_info[0] == 0)") != std::string::npos);
+  ASSERT_TRUE(output.find("(_occa_thread_info[0] == 1)") != std::string::npos);
+  ASSERT_TRUE(output.find("(i < 0 + _occa_thread_info[2])") != std::string::npos);
+  ASSERT_TRUE(output.find("(i > N - (2 * _occa_thread_info[2]))") != std::string::npos);
+}
+//======================================
+
+//---[ Outer Statement Guards ]---------
+void testOuterStatementGuards() {
+  parseSource(
+    "@kernel void foo(const int N, int *counter) {\n"
+    "  int entries;\n"
+    "  entries = N;\n"
+    "  counter[0] += 1;\n"
+    "  for (int i = 0; i < entries; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {}\n"
+    "  }\n"
+    "  counter[0] += 2;\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  // Memory writes run once, in the size query of the loop after them
+  functionDeclStatement &foo = getKernel();
+  ASSERT_EQ(6,
+            foo.size());
+  ASSERT_EQ_BINARY(statementType::expression,
+                   foo[1]->type());
+  ASSERT_EQ_BINARY(statementType::if_,
+                   foo[2]->type());
+  ASSERT_EQ_BINARY(statementType::if_,
+                   foo[5]->type());
+
+  printer pout;
+  foo.print(pout);
+  const std::string output = pout.str();
+  ASSERT_TRUE(output.find("_occa_thread_info[0] == -2") != std::string::npos);
+
+  // Writing both memory and kernel-wide variables can't be split up
+  parseBadSource(
+    "@kernel void foo(const int N, int *counter) {\n"
+    "  int entries;\n"
+    "  entries = counter[0]++;\n"
+    "  for (int i = 0; i < entries; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+}
+//======================================
@@ -27,6 +27,7 @@
 #include <occa/lang/tokenizer.hpp>
 #include <occa/lang/processingStages.hpp>
 #include <occa/lang/preprocessor.hpp>
+#include <occa/lang/headerCache.hpp>
 
 void testMacroDefines();
 void testCppStandardTests();
@@ -36,6 +37,7 @@ void testIfWithUndefines();
 void testErrorDefines();
 void testSpecialMacros();
 void testInclude();
+void testIncludeGuards();
 void testPragma();
 void testOccaPragma();
 
@@ -101,6 +103,7 @@ int main(const int argc, const char **argv) {
   testErrorDefines();
   testSpecialMacros();
   testInclude();
+  testIncludeGuards();
   testPragma();
   testOccaPragma();
 
@@ -600,6 +603,61 @@ void testInclude() {
             (int) pp.dependencies.size());
 }
 
+void testIncludeGuards() {
+  const std::string guardedFile = (occa::env::OCCA_DIR
+                                   + "tests/files/guardedHeader.hpp");
+  const std::string onceFile = (occa::env::OCCA_DIR
+                                + "tests/files/pragmaOnceHeader.hpp");
+
+  headerCache_t &cache = headerCache_t::get();
+  cachedHeader_t &guardedHeader = *(cache.getHeader(guardedFile));
+  cachedHeader_t &onceHeader = *(cache.getHeader(onceFile));
+  ASSERT_EQ(&guardedHeader, cache.getHeader(guardedFile));
+
+  ASSERT_EQ("OCCA_TEST_GUARDED_HEADER", guardedHeader.guardName);
+  ASSERT_FALSE(guardedHeader.pragmaOnce);
+  ASSERT_TRUE(guardedHeader.replayable);
+
+  ASSERT_EQ(0, (int) onceHeader.guardName.size());
+  ASSERT_TRUE(onceHeader.pragmaOnce);
+
+  // Second includes are skipped
+  std::stringstream ss;
+  ss << "#include \"" << guardedFile << "\"\n"
+     << "#include \"" << guardedFile << "\"\n"
+     << "#include \"" << onceFile << "\"\n"
+     << "#include \"" << onceFile << "\"\n"
+     << "9\n";
+  for (int pass = 0; pass < 2; ++pass) {
+    setStream(ss.str());
+    ASSERT_EQ(5, (int) nextTokenPrimitiveValue());
+    ASSERT_EQ(6, (int) nextTokenPrimitiveValue());
+    getToken();
+    ASSERT_EQ_BINARY(tokenType::pragma,
+                     token->type());
+    ASSERT_EQ(7, (int) nextTokenPrimitiveValue());
+    ASSERT_EQ(8, (int) nextTokenPrimitiveValue());
+    ASSERT_EQ(9, (int) nextTokenPrimitiveValue());
+    getToken();
+    ASSERT_EQ((void*) NULL, (void*) token);
+  }
+
+  // Guards with an #else branch still expand on re-includes
+  const std::string elseFile = (occa::env::OCCA_DIR
+                                + "tests/files/elseGuardedHeader.hpp");
+  cachedHeader_t &elseHeader = *(cache.getHeader(elseFile));
+  ASSERT_EQ(0, (int) elseHeader.guardName.size());
+
+  ss.str("");
+  ss << "#include \"" << elseFile << "\"\n"
+     << "#include \"" << elseFile << "\"\n"
+     << "12\n";
+  setStream(ss.str());
+  ASSERT_EQ(10, (int) nextTokenPrimitiveValue());
+  ASSERT_EQ(11, (int) nextTokenPrimitiveValue());
+  ASSERT_EQ(12, (int) nextTokenPrimitiveValue());
+}
+
 void testPragma() {
   setStream("#pragma\n");
   getToken();
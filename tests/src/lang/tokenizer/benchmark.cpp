@@ -0,0 +1,98 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/tools/sys.hpp>
+
+#include "utils.hpp"
+
+std::string generateSource(const int kernels);
+int countTokens(const std::string &source,
+                int &identifiers,
+                int &primitives,
+                int &operators);
+void testBenchmark();
+
+int main(const int argc, const char **argv) {
+  testBenchmark();
+
+  return 0;
+}
+
+std::string generateSource(const int kernels) {
+  std::stringstream ss;
+  for (int i = 0; i < kernels; ++i) {
+    ss << "// Kernel " << i << "\n"
+       << "@kernel void addVectors" << i << "(const int entries,\n"
+       << "                         const float *a,\n"
+       << "                         const float *b,\n"
+       << "                         float *ab) {\n"
+       << "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+       << "    /* Scaled sum */\n"
+       << "    const float x = a[i] * 2.0f + (b[i] - 1.0f) / 3.0f;\n"
+       << "    ab[i] = x * x + a[i] + b[i] + 0x1F;\n"
+       << "  }\n"
+       << "}\n\n";
+  }
+  return ss.str();
+}
+
+int countTokens(const std::string &source,
+                int &identifiers,
+                int &primitives,
+                int &operators) {
+  identifiers = primitives = operators = 0;
+  setStream(source);
+
+  int tokens = 0;
+  while (!tokenizer.isEmpty()) {
+    getToken();
+    const int type = getTokenType();
+    identifiers += (bool) (type & tokenType::identifier);
+    primitives  += (bool) (type & tokenType::primitive);
+    operators   += (bool) (type & tokenType::op);
+    ++tokens;
+  }
+  return tokens;
+}
+
+void testBenchmark() {
+  const int kernels = 2000;
+  const std::string source = generateSource(kernels);
+
+  int identifiers, primitives, operators;
+  const double start = occa::sys::currentTime();
+  const int tokens = countTokens(source,
+                                 identifiers,
+                                 primitives,
+                                 operators);
+  const double elapsed = occa::sys::currentTime() - start;
+
+  // Check the counts so the benchmark also guards the fast paths
+  ASSERT_EQ(38 * kernels, identifiers);
+  ASSERT_EQ(6 * kernels, primitives);
+  ASSERT_EQ(52 * kernels, operators);
+  // The rest are newlines
+  ASSERT_EQ(108 * kernels, tokens);
+
+  std::cout << "Tokenized " << source.size() << " bytes ("
+            << tokens << " tokens) in " << elapsed << " s: "
+            << (int) (source.size() / (elapsed * 1e6)) << " MB/s\n";
+}
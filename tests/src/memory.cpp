@@ -0,0 +1,169 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/tools/testing.hpp>
+
+#include <occa.hpp>
+
+void testPoolBlockSize();
+void testPoolReuse();
+void testPoolTrim();
+void testPoolUva();
+void testPoolProperties();
+
+int main(const int argc, const char **argv) {
+  testPoolBlockSize();
+  testPoolReuse();
+  testPoolTrim();
+  testPoolUva();
+  testPoolProperties();
+
+  return 0;
+}
+
+void testPoolBlockSize() {
+  ASSERT_EQ(occa::modeDevice_t::poolBlockSize(1),
+            (occa::udim_t) 256);
+  ASSERT_EQ(occa::modeDevice_t::poolBlockSize(256),
+            (occa::udim_t) 256);
+  ASSERT_EQ(occa::modeDevice_t::poolBlockSize(257),
+            (occa::udim_t) 320);
+  ASSERT_EQ(occa::modeDevice_t::poolBlockSize(512),
+            (occa::udim_t) 512);
+  ASSERT_EQ(occa::modeDevice_t::poolBlockSize(1000),
+            (occa::udim_t) 1024);
+
+  // Size classes never waste more than a quarter of the block
+  for (occa::udim_t bytes = 257; bytes < (1 << 20); bytes += 97) {
+    const occa::udim_t blockBytes = occa::modeDevice_t::poolBlockSize(bytes);
+    ASSERT_LE(bytes, blockBytes);
+    ASSERT_LE(blockBytes - bytes, bytes / 4);
+  }
+}
+
+void testPoolReuse() {
+  occa::device device("mode: 'Serial', memory: { pool: true }");
+
+  occa::memory mem1 = device.malloc(1000);
+  void *ptr = mem1.ptr();
+  ASSERT_EQ(mem1.size(),
+            (occa::udim_t) 1000);
+  ASSERT_EQ(device.memoryAllocated(),
+            (occa::udim_t) 1000);
+
+  mem1.free();
+  ASSERT_FALSE(mem1.isInitialized());
+  ASSERT_EQ(device.memoryAllocated(),
+            (occa::udim_t) 0);
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 1024);
+
+  // Same size class reuses the block
+  int values[250];
+  for (int i = 0; i < 250; ++i) {
+    values[i] = i;
+  }
+  occa::memory mem2 = device.malloc(1000, values);
+  ASSERT_EQ(mem2.ptr(), ptr);
+  ASSERT_EQ(mem2.size(),
+            (occa::udim_t) 1000);
+  ASSERT_EQ(((int*) mem2.ptr())[249], 249);
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 0);
+
+  // Dropping the last reference also returns the block
+  occa::memory mem3 = device.malloc(2000);
+  mem3 = occa::memory();
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 2048);
+
+  // Unpooled allocations are unaffected
+  occa::memory mem4 = device.malloc(1000,
+                                     occa::properties("pool: false"));
+  ASSERT_NEQ(mem4.ptr(), ptr);
+  mem4.free();
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 2048);
+
+  ASSERT_EQ(device.maxMemoryAllocated(),
+            (occa::udim_t) 3000);
+}
+
+void testPoolTrim() {
+  occa::device device("mode: 'Serial', memory: { pool: true }");
+
+  for (int i = 0; i < 10; ++i) {
+    occa::memory mem = device.malloc(300);
+    mem.free();
+  }
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 320);
+
+  device.trimMemoryPool();
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 0);
+
+  // Blocks left in the pool are released with the device
+  occa::memory mem = device.malloc(300);
+  mem.free();
+  device.free();
+}
+
+void testPoolUva() {
+  occa::device device("mode: 'Serial', memory: { pool: true }");
+
+  int *ptr = (int*) device.umalloc(100 * sizeof(int));
+  ptr[99] = 99;
+  occa::free(ptr);
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 448);
+
+  int *ptr2 = (int*) device.umalloc(100 * sizeof(int));
+  ASSERT_EQ(ptr2, ptr);
+  ASSERT_TRUE(occa::memory(ptr2).isInitialized());
+  occa::free(ptr2);
+}
+
+void testPoolProperties() {
+  occa::device device("mode: 'Serial', memory: { pool: true }");
+
+  occa::memory mem = device.malloc(1000,
+                                   occa::properties("mapped: true"));
+  void *ptr = mem.ptr();
+  mem.free();
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 1024);
+
+  // Blocks are only reused for allocations with matching properties
+  occa::memory mem2 = device.malloc(1000);
+  ASSERT_NEQ(mem2.ptr(), ptr);
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 1024);
+
+  occa::memory mem3 = device.malloc(1000,
+                                    occa::properties("mapped: true"));
+  ASSERT_EQ(mem3.ptr(), ptr);
+  ASSERT_EQ(device.memoryPooled(),
+            (occa::udim_t) 0);
+
+  mem2.free();
+  mem3.free();
+}
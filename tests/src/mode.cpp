@@ -21,12 +21,15 @@
  */
 #include <occa/tools/testing.hpp>
 
+#include <occa.hpp>
 #include <occa/mode.hpp>
 
 void testMode();
+void testThreadsKernel();
 
 int main(const int argc, const char **argv) {
   testMode();
+  testThreadsKernel();
 
   return 0;
 }
@@ -42,3 +45,52 @@ void testMode() {
   ASSERT_EQ(occa::getMode("mode: 'Foo'"),
             serialMode);
 }
+
+void testThreadsKernel() {
+  occa::device device("mode: 'Threads', threads: 4");
+
+  // Statements outside @outer loops have to run once, in order
+  occa::kernel multiLoop = device.buildKernelFromString(
+    "@kernel void multiLoop(const int N,\n"
+    "                       int *counter,\n"
+    "                       float *a,\n"
+    "                       float *last,\n"
+    "                       float *b) {\n"
+    "  int entries;\n"
+    "  entries = N;\n"
+    "  counter[0] += 1;\n"
+    "  for (int i = 0; i < entries; ++i; @tile(4, @outer, @inner)) {\n"
+    "    a[i] = i;\n"
+    "  }\n"
+    "  last[0] = a[entries - 1];\n"
+    "  for (int i = 0; i < entries; ++i; @tile(4, @outer, @inner)) {\n"
+    "    b[i] = a[i] + last[0];\n"
+    "  }\n"
+    "  counter[0] += 10;\n"
+    "}\n",
+    "multiLoop"
+  );
+
+  const int entries = 103;
+  int counter = 0;
+  float zeros[entries], b[entries];
+  for (int i = 0; i < entries; ++i) {
+    zeros[i] = 0;
+  }
+  occa::memory o_counter = device.malloc(sizeof(int), &counter);
+  occa::memory o_a = device.malloc(entries * sizeof(float), zeros);
+  occa::memory o_last = device.malloc(sizeof(float), zeros);
+  occa::memory o_b = device.malloc(entries * sizeof(float), zeros);
+
+  for (int run = 1; run <= 3; ++run) {
+    multiLoop(entries, o_counter, o_a, o_last, o_b);
+    device.finish();
+
+    o_counter.copyTo(&counter);
+    o_b.copyTo(b);
+    ASSERT_EQ(counter, 11 * run);
+    for (int i = 0; i < entries; ++i) {
+      ASSERT_EQ(b[i], (float) (i + entries - 1));
+    }
+  }
+}
@@ -0,0 +1,168 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <set>
+
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+const std::string waitSource = (
+  "@kernel void waitForFlag(volatile int *flag,\n"
+  "                         int *result) {\n"
+  "  for (int i = 0; i < 1; ++i; @outer) {\n"
+  "    for (int j = 0; j < 1; ++j; @inner) {\n"
+  "      // Give up after a few seconds\n"
+  "      long spins = 0;\n"
+  "      while (!flag[0] && (spins < 4000000000L)) {\n"
+  "        ++spins;\n"
+  "      }\n"
+  "      result[0] = (flag[0] ? 1 : 2);\n"
+  "    }\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "@kernel void spin(const int iterations,\n"
+  "                  int *result) {\n"
+  "  for (int i = 0; i < 1; ++i; @outer) {\n"
+  "    for (int j = 0; j < 1; ++j; @inner) {\n"
+  "      volatile int value = 0;\n"
+  "      for (int k = 0; k < iterations; ++k) {\n"
+  "        value = value + 1;\n"
+  "      }\n"
+  "      result[0] = value;\n"
+  "    }\n"
+  "  }\n"
+  "}\n"
+);
+
+occa::device device;
+occa::kernel waitForFlag, spin;
+
+void testAsyncLaunch();
+void testWaitFor();
+void testTimeBetween();
+void testFinish();
+
+int main(const int argc, const char **argv) {
+  device.setup("mode: 'Serial'");
+  waitForFlag = device.buildKernelFromString(waitSource, "waitForFlag");
+  spin = device.buildKernelFromString(waitSource, "spin");
+
+  testAsyncLaunch();
+  testWaitFor();
+  testTimeBetween();
+  testFinish();
+
+  return 0;
+}
+
+void testAsyncLaunch() {
+  int zero = 0;
+  occa::memory o_flag = device.malloc(sizeof(int), &zero);
+  occa::memory o_result = device.malloc(sizeof(int), &zero);
+  volatile int *flag = (volatile int*) o_flag.ptr();
+
+  // The kernel only sees the flag if the launch returns before it ends
+  waitForFlag(o_flag, o_result);
+  flag[0] = 1;
+  device.finish();
+
+  ASSERT_EQ(((int*) o_result.ptr())[0],
+            1);
+}
+
+void testWaitFor() {
+  const int iterations = 50000000;
+  int zero = 0;
+  occa::memory o_result = device.malloc(sizeof(int), &zero);
+  volatile int *result = (volatile int*) o_result.ptr();
+
+  spin(iterations, o_result);
+  occa::streamTag tag = device.tagStream();
+  ASSERT_NEQ(tag.modeTag,
+             (void*) NULL);
+
+  device.waitFor(tag);
+  ASSERT_EQ(result[0],
+            iterations);
+
+  // Tags on idle streams are already done
+  device.finish();
+  occa::streamTag idleTag = device.tagStream();
+  ASSERT_EQ(idleTag.modeTag,
+            (void*) NULL);
+  device.waitFor(idleTag);
+}
+
+void testTimeBetween() {
+  const int iterations = 50000000;
+  int zero = 0;
+  occa::memory o_result = device.malloc(sizeof(int), &zero);
+
+  // Keep the stream busy so both tags are queued
+  spin(iterations, o_result);
+  occa::streamTag startTag = device.tagStream();
+  spin(iterations, o_result);
+  occa::streamTag endTag = device.tagStream();
+  ASSERT_NEQ(startTag.modeTag,
+             (void*) NULL);
+  ASSERT_NEQ(endTag.modeTag,
+             (void*) NULL);
+
+  ASSERT_GT(device.timeBetween(startTag, endTag),
+            0);
+
+  // Finished tags are recycled instead of piling up
+  std::set<void*> modeTags;
+  for (int i = 0; i < 2048; ++i) {
+    spin(1000, o_result);
+    occa::streamTag tag = device.tagStream();
+    if (tag.modeTag) {
+      modeTags.insert(tag.modeTag);
+    }
+    device.waitFor(tag);
+  }
+  ASSERT_LE((int) modeTags.size(),
+            1024);
+}
+
+void testFinish() {
+  const int iterations = 50000000;
+  int zero = 0;
+  occa::memory o_result1 = device.malloc(sizeof(int), &zero);
+  occa::memory o_result2 = device.malloc(sizeof(int), &zero);
+
+  occa::stream stream1 = device.getStream();
+  occa::stream stream2 = device.createStream();
+
+  spin(iterations, o_result1);
+  device.setStream(stream2);
+  spin(iterations, o_result2);
+  device.setStream(stream1);
+
+  device.finish();
+  ASSERT_EQ(((int*) o_result1.ptr())[0],
+            iterations);
+  ASSERT_EQ(((int*) o_result2.ptr())[0],
+            iterations);
+
+  device.freeStream(stream2);
+}
@@ -0,0 +1,140 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+
+#include <stdlib.h>
+#include <vector>
+
+#include <occa/tools/hash.hpp>
+#include <occa/tools/sys.hpp>
+#include <occa/tools/testing.hpp>
+
+void testHashValues();
+void testStreaming();
+void benchmarkHash();
+
+int main(const int argc, const char **argv) {
+  testHashValues();
+  testStreaming();
+  benchmarkHash();
+
+  return 0;
+}
+
+void testHashValues() {
+  ASSERT_TRUE(occa::hash("").isInitialized());
+
+  ASSERT_EQ(occa::hash("occa"),
+            occa::hash(std::string("occa")));
+  ASSERT_NEQ(occa::hash("occa"),
+             occa::hash("occb"));
+
+  // Zero padding of the tail doesn't collide
+  const char zeros[2] = {0, 0};
+  ASSERT_NEQ(occa::hash(zeros, 1),
+             occa::hash(zeros, 2));
+
+  // toString() keeps the 16 character cache directory format
+  ASSERT_EQ((int) occa::hash("occa").toString().size(),
+            16);
+  ASSERT_EQ((int) occa::hash("occa").toFullString().size(),
+            64);
+
+  const occa::hash_t h = occa::hash("occa");
+  ASSERT_EQ(occa::hash_t::fromString(h.toFullString()),
+            h);
+}
+
+void testStreaming() {
+  std::vector<char> data(1000);
+  for (int i = 0; i < (int) data.size(); ++i) {
+    data[i] = (char) rand();
+  }
+  const occa::hash_t expected = occa::hash(&(data[0]), data.size());
+
+  // Any chunking gives the same hash
+  const int chunkSizes[5] = {1, 7, 31, 32, 333};
+  for (int c = 0; c < 5; ++c) {
+    occa::hasher_t hasher;
+    for (int i = 0; i < (int) data.size(); i += chunkSizes[c]) {
+      const int bytes = std::min(chunkSizes[c],
+                                 (int) data.size() - i);
+      hasher.update(&(data[i]), bytes);
+    }
+    ASSERT_EQ(hasher.digest(),
+              expected);
+  }
+
+  occa::hasher_t hasher;
+  hasher.update("oc").update(std::string("ca"));
+  ASSERT_EQ(hasher.digest(),
+            occa::hash("occa"));
+
+  hasher.clear();
+  ASSERT_EQ(hasher.digest(),
+            occa::hash(""));
+}
+
+// Previous byte-at-a-time implementation, kept for comparison
+occa::hash_t legacyHash(const void *ptr, occa::udim_t bytes) {
+  const char *c = (char*) ptr;
+
+  occa::hash_t hash;
+  int *h = hash.h;
+
+  const int p[8] = {
+    102679, 102701, 102761, 102763,
+    102769, 102793, 102797, 102811
+  };
+
+  for (occa::udim_t i = 0; i < bytes; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      h[j] = (h[j] * p[j]) ^ c[i];
+    }
+  }
+  hash.initialized = true;
+
+  return hash;
+}
+
+void benchmarkHash() {
+  const int bytes = (8 << 20);
+  std::vector<char> data(bytes);
+  for (int i = 0; i < bytes; ++i) {
+    data[i] = (char) rand();
+  }
+
+  double start = occa::sys::currentTime();
+  const occa::hash_t legacy = legacyHash(&(data[0]), bytes);
+  const double legacyTime = occa::sys::currentTime() - start;
+
+  start = occa::sys::currentTime();
+  const occa::hash_t current = occa::hash(&(data[0]), bytes);
+  const double currentTime = occa::sys::currentTime() - start;
+
+  ASSERT_TRUE(legacy.isInitialized());
+  ASSERT_TRUE(current.isInitialized());
+
+  const double mb = bytes / (1024.0 * 1024.0);
+  std::cout << "Hashing " << mb << " MB:\n"
+            << "  legacy : " << (mb / legacyTime) << " MB/s\n"
+            << "  current: " << (mb / currentTime) << " MB/s\n";
+}
@@ -0,0 +1,109 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+void testRecord();
+void testDeviceEvents();
+
+int main(const int argc, const char **argv) {
+  testRecord();
+  testDeviceEvents();
+
+  return 0;
+}
+
+void testRecord() {
+  occa::profiler.clear();
+  occa::profiler.disable();
+
+  occa::profiler.record("kernel", "foo", 0, 1);
+  ASSERT_EQ(occa::profiler.size(), 0);
+
+  occa::profiler.enable();
+  occa::profiler.record("kernel", "foo", 1, 2, 8);
+  occa::profiler.record("kernel", "foo", 2, 5, 8);
+  occa::profiler.record("copy", "copyTo", 3, 4, 16);
+  {
+    occa::profileScope_t scope("kernel", "bar");
+  }
+  ASSERT_EQ(occa::profiler.size(), 4);
+
+  occa::json stats = occa::profiler.getStats();
+  occa::json &foo = stats["kernel"]["foo"];
+  ASSERT_EQ((int) foo["count"], 2);
+  ASSERT_EQ((double) foo["total"], 4.0);
+  ASSERT_EQ((double) foo["min"], 1.0);
+  ASSERT_EQ((double) foo["max"], 3.0);
+  ASSERT_EQ((double) foo["average"], 2.0);
+  ASSERT_EQ((double) foo["bytes"], 16.0);
+  ASSERT_EQ((int) stats["kernel"]["bar"]["count"], 1);
+  ASSERT_EQ((int) stats["copy"]["copyTo"]["count"], 1);
+
+  occa::json trace = occa::profiler.toJson();
+  ASSERT_EQ((int) trace["traceEvents"].array().size(), 4);
+  occa::json &event = trace["traceEvents"][0];
+  ASSERT_EQ((std::string) event["ph"], "X");
+  ASSERT_EQ((std::string) event["cat"], "kernel");
+  ASSERT_EQ((double) event["dur"], 1e6);
+  ASSERT_EQ((int) event["tid"], occa::sys::getTID());
+
+  occa::profiler.disable();
+  occa::profiler.clear();
+  ASSERT_EQ(occa::profiler.size(), 0);
+}
+
+void testDeviceEvents() {
+  occa::device device("mode: 'Serial', profile: true");
+  ASSERT_TRUE(occa::profiler.isEnabled());
+
+  occa::kernel addVectors = device.buildKernel(
+    occa::env::OCCA_DIR + "tests/files/addVectors.okl",
+    "addVectors"
+  );
+
+  const int entries = 16;
+  float a[entries];
+  occa::memory o_a = device.malloc(entries * sizeof(float));
+  occa::memory o_b = device.malloc(entries * sizeof(float));
+  occa::memory o_ab = device.malloc(entries * sizeof(float));
+  o_a.copyFrom(a);
+  o_b.copyFrom(a);
+  addVectors(entries, o_a, o_b, o_ab);
+  addVectors(entries, o_a, o_b, o_ab);
+  o_ab.copyTo(a);
+  o_a.free();
+
+  occa::json stats = occa::profiler.getStats();
+  ASSERT_EQ((int) stats["kernel"]["addVectors"]["count"], 2);
+  ASSERT_EQ((int) stats["malloc"]["Serial"]["count"], 3);
+  ASSERT_EQ((double) stats["malloc"]["Serial"]["bytes"],
+            (double) (3 * entries * sizeof(float)));
+  ASSERT_EQ((int) stats["copy"]["copyFrom"]["count"], 2);
+  ASSERT_EQ((int) stats["copy"]["copyTo"]["count"], 1);
+  ASSERT_EQ((int) stats["free"]["Serial"]["count"], 1);
+  ASSERT_EQ((int) stats["build"]["addVectors"]["count"], 1);
+  ASSERT_EQ((int) stats["load"]["addVectors"]["count"], 1);
+
+  occa::profiler.disable();
+  occa::profiler.clear();
+}
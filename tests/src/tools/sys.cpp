@@ -28,11 +28,15 @@
 #include <occa/tools/testing.hpp>
 
 void testRmrf();
+void testCommands();
+void testProcesses();
 
 int main(const int argc, const char **argv) {
   srand(time(NULL));
 
   testRmrf();
+  testCommands();
+  testProcesses();
 
   return 0;
 }
@@ -77,3 +81,73 @@ void testRmrf() {
   occa::settings()["options/safe-rmrf"] = false;
   occa::sys::rmrf(filename);
 }
+
+void testCommands() {
+  occa::strVector args = occa::sys::splitCommand(
+    "g++  -O3 'a b' \"c \\\" d\" e\\ f"
+  );
+  ASSERT_EQ(5, (int) args.size());
+  ASSERT_EQ("g++", args[0]);
+  ASSERT_EQ("-O3", args[1]);
+  ASSERT_EQ("a b", args[2]);
+  ASSERT_EQ("c \" d", args[3]);
+  ASSERT_EQ("e f", args[4]);
+
+  args.push_back("it's");
+  args.push_back("");
+  ASSERT_EQ("g++ -O3 'a b' 'c \" d' 'e f' 'it'\\''s' ''",
+            occa::sys::joinCommand(args));
+
+  // Joining and splitting should round-trip
+  const occa::strVector args2 = occa::sys::splitCommand(
+    occa::sys::joinCommand(args)
+  );
+  ASSERT_EQ(args.size(), args2.size());
+  for (int i = 0; i < (int) args.size(); ++i) {
+    ASSERT_EQ(args[i], args2[i]);
+  }
+
+  // Compiler flags are expanded like /bin/sh would
+  ::setenv("OCCA_TEST_PREFIX", "/opt/occa test", 1);
+  const occa::strVector flags = occa::sys::expandCommand(
+    "-I\"$OCCA_TEST_PREFIX/include\" $(echo -O3 -g) 'a b'"
+  );
+  ASSERT_EQ(4, (int) flags.size());
+  ASSERT_EQ("-I/opt/occa test/include", flags[0]);
+  ASSERT_EQ("-O3", flags[1]);
+  ASSERT_EQ("-g", flags[2]);
+  ASSERT_EQ("a b", flags[3]);
+
+  // Characters wordexp rejects fall back to splitting
+  const occa::strVector defines = occa::sys::expandCommand(
+    "-DMAX(a,b)=a -O3"
+  );
+  ASSERT_EQ(2, (int) defines.size());
+  ASSERT_EQ("-DMAX(a,b)=a", defines[0]);
+}
+
+void testProcesses() {
+  occa::strVector args;
+  args.push_back("/bin/sh");
+  args.push_back("-c");
+  args.push_back("echo out; echo err 1>&2; exit 3");
+
+  std::string output;
+  ASSERT_EQ(3, occa::sys::runProcess(args, output));
+  ASSERT_NEQ(std::string::npos, output.find("out\n"));
+  ASSERT_NEQ(std::string::npos, output.find("err\n"));
+
+  // Processes past the timeout get killed
+  args[2] = "sleep 10";
+  output = "";
+  const double start = occa::sys::currentTime();
+  ASSERT_EQ(-1, occa::sys::runProcess(args, output, 0.2));
+  ASSERT_LT(occa::sys::currentTime() - start, 5.0);
+
+  // Missing binaries fail without throwing
+  args.clear();
+  args.push_back("occa_missing_binary_for_this_sys_test");
+  output = "";
+  ASSERT_EQ(127, occa::sys::runProcess(args, output));
+  ASSERT_NEQ(std::string::npos, output.find("occa_missing_binary_for_this_sys_test"));
+}
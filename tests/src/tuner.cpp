@@ -0,0 +1,107 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018 David Medina and Tim Warburton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ */
+#include <occa/tools/testing.hpp>
+
+#include <occa.hpp>
+
+const std::string tunedKernelFile = (
+  occa::env::OCCA_DIR + "tests/files/tunedKernel.okl"
+);
+
+void testBuild();
+void testTune();
+
+int main(const int argc, const char **argv) {
+  testBuild();
+  testTune();
+
+  return 0;
+}
+
+void testBuild() {
+  occa::device device("mode: 'Serial'");
+  occa::kernelTuner tuner(tunedKernelFile, "scaleVector");
+
+  occa::kernel scaleVector = tuner.build(device, occa::intVector());
+  const std::vector<occa::strVector> &tunables = (
+    scaleVector.getModeKernel()->metadata.tunables
+  );
+  ASSERT_EQ((int) tunables.size(), 1);
+  ASSERT_EQ((int) tunables[0].size(), 3);
+  ASSERT_EQ(tunables[0][2], "32");
+
+  occa::intVector options;
+  options.push_back(3);
+  ASSERT_THROW(
+    tuner.build(device, options);
+  );
+
+  occa::intVector choices(2, 0);
+  std::vector<occa::strVector> sites(2, occa::strVector(2));
+  int combinations = 1;
+  while (occa::kernelTuner::nextOptions(sites, choices)) {
+    ++combinations;
+  }
+  ASSERT_EQ(combinations, 4);
+  ASSERT_EQ(choices[0], 0);
+  ASSERT_EQ(choices[1], 0);
+}
+
+void testTune() {
+  occa::device device("mode: 'Serial'");
+  occa::kernelTuner tuner(tunedKernelFile, "scaleVector");
+
+  const std::string tuneFile = tuner.getCacheFilename(device);
+  occa::sys::rmrf(tuneFile);
+  ASSERT_FALSE(tuner.isTuned(device));
+
+  const int entries = 100;
+  float a[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = 1;
+  }
+  occa::memory o_a = device.malloc(entries * sizeof(float), a);
+
+  occa::kernel defaultKernel = tuner.build(device);
+  occa::kernelFrame frame = defaultKernel.bind(entries, 1.0f, o_a);
+
+  occa::kernel scaleVector = tuner.tune(device, frame, 2);
+  ASSERT_TRUE(tuner.isTuned(device));
+  ASSERT_TRUE(scaleVector.isInitialized());
+
+  occa::json results = occa::json::parse(occa::io::read(tuneFile));
+  ASSERT_EQ(results["kernel"].string(), "scaleVector");
+  ASSERT_EQ((int) results["variants"].array().size(), 3);
+
+  const occa::intVector options = tuner.getTunedOptions(device);
+  ASSERT_EQ((int) options.size(), 1);
+
+  // Later tuners reuse the stored winner
+  occa::kernelTuner cachedTuner(tunedKernelFile, "scaleVector");
+  ASSERT_EQ(cachedTuner.build(device).properties().get<std::string>("hash"),
+            scaleVector.properties().get<std::string>("hash"));
+
+  o_a.copyTo(a);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(a[i], 1.0f);
+  }
+}
@@ -19,6 +19,8 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  */
+#include <pthread.h>
+
 #include <occa/tools/testing.hpp>
 
 #include <occa.hpp>
@@ -26,11 +28,19 @@
 void testPtrRange();
 void testUva();
 void testUvaNull();
+void testStaleMemory();
+void testUvaIndex();
+void testUvaIndexReclaim();
+void benchmarkUvaIndex();
 
 int main(const int argc, const char **argv) {
   testPtrRange();
   testUva();
   testUvaNull();
+  testStaleMemory();
+  testUvaIndex();
+  testUvaIndexReclaim();
+  benchmarkUvaIndex();
 
   return 0;
 }
@@ -162,3 +172,239 @@ void testUvaNull() {
 
   delete [] ptr;
 }
+
+void testStaleMemory() {
+  occa::device device("mode: 'Serial'");
+  occa::modeDevice_t *modeDevice = device.getModeDevice();
+
+  const int memCount = 10000;
+  std::vector<occa::memory> mems(memCount);
+  for (int i = 0; i < memCount; ++i) {
+    mems[i] = device.malloc(sizeof(int));
+    mems[i].uvaMarkStale();
+    // Marking twice doesn't add duplicates
+    mems[i].uvaMarkStale();
+  }
+
+  int staleCount = 0;
+  for (occa::modeMemory_t *mem = modeDevice->staleMemory;
+       mem;
+       mem = mem->rightStaleEntry) {
+    ++staleCount;
+  }
+  ASSERT_EQ(staleCount, memCount);
+
+  // Remove from the middle, then free a stale entry
+  mems[memCount / 2].uvaMarkFresh();
+  ASSERT_FALSE(mems[memCount / 2].uvaIsStale());
+  occa::removeFromStaleMap(mems[0].getModeMemory());
+  ASSERT_FALSE(mems[0].uvaIsStale());
+  mems[1].free();
+
+  staleCount = 0;
+  for (occa::modeMemory_t *mem = modeDevice->staleMemory;
+       mem;
+       mem = mem->rightStaleEntry) {
+    ASSERT_TRUE(mem->isStale());
+    ++staleCount;
+  }
+  ASSERT_EQ(staleCount, memCount - 3);
+
+  for (int i = 0; i < memCount; ++i) {
+    mems[i].free();
+  }
+  ASSERT_EQ(modeDevice->staleMemory,
+            (occa::modeMemory_t*) NULL);
+
+  // Host-only devices have nothing to sync
+  ASSERT_EQ(device.bytesSyncedToHost(),
+            (occa::udim_t) 0);
+}
+
+// Fake addresses, the index never dereferences them
+char* rangeStart(const int i) {
+  return ((char*) NULL) + (4096 * (i + 2));
+}
+
+occa::modeMemory_t* rangeMemory(const int i) {
+  return (occa::modeMemory_t*) (((char*) NULL) + (8 * (i + 2)));
+}
+
+void testUvaIndex() {
+  occa::uvaIndex index;
+  ASSERT_EQ(index.find(rangeStart(0)),
+            (occa::modeMemory_t*) NULL);
+
+  // Insert out of order to exercise chunk splits
+  const int entries = 1000;
+  for (int i = 0; i < entries; ++i) {
+    const int r = (i * 7) % entries;
+    index.insert(occa::ptrRange(rangeStart(r), 1000),
+                 rangeMemory(r));
+  }
+  ASSERT_EQ(index.size(),
+            (size_t) entries);
+
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(index.find(rangeStart(i)),
+              rangeMemory(i));
+    ASSERT_EQ(index.find(rangeStart(i) + 999),
+              rangeMemory(i));
+    ASSERT_EQ(index.find(rangeStart(i) + 1000),
+              (occa::modeMemory_t*) NULL);
+  }
+  ASSERT_EQ(index.find(rangeStart(-1)),
+            (occa::modeMemory_t*) NULL);
+
+  // Empty ranges match their start
+  index.insert(rangeStart(-1), rangeMemory(-1));
+  ASSERT_EQ(index.find(rangeStart(-1)),
+            rangeMemory(-1));
+  ASSERT_EQ(index.find(rangeStart(-1) + 1),
+            (occa::modeMemory_t*) NULL);
+
+  // Reinserting the same start replaces the entry
+  index.insert(occa::ptrRange(rangeStart(5), 1000),
+               rangeMemory(-1));
+  ASSERT_EQ(index.find(rangeStart(5) + 10),
+            rangeMemory(-1));
+  ASSERT_EQ(index.size(),
+            (size_t) (entries + 1));
+
+  // Erase through any pointer inside the range
+  for (int i = 0; i < entries; i += 2) {
+    index.erase(rangeStart(i) + 10);
+  }
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(index.find(rangeStart(i)) == NULL,
+              (i % 2) == 0);
+  }
+  for (int i = 1; i < entries; i += 2) {
+    index.erase(rangeStart(i));
+  }
+  index.erase(rangeStart(-1));
+  ASSERT_EQ(index.size(),
+            (size_t) 0);
+
+  index.insert(occa::ptrRange(rangeStart(0), 1),
+               rangeMemory(0));
+  ASSERT_EQ(index.find(rangeStart(0)),
+            rangeMemory(0));
+}
+
+class uvaReader_t {
+public:
+  occa::uvaIndex *index;
+  int entries;
+  int lookups;
+  int misses;
+};
+
+void* readUvaIndex(void *args) {
+  uvaReader_t &reader = *((uvaReader_t*) args);
+  reader.misses = 0;
+  for (int i = 0; i < reader.lookups; ++i) {
+    const int r = (int) ((i * 2654435761U) % reader.entries);
+    if (reader.index->find(rangeStart(r) + 100) != rangeMemory(r)) {
+      ++reader.misses;
+    }
+  }
+  return NULL;
+}
+
+void testUvaIndexReclaim() {
+  occa::uvaIndex index;
+  int parities[2];
+  occa::uvaIndex::readerSlot_t *slots[2];
+
+  // Updates keep what the first reader could be using
+  slots[0] = &(index.startReading(parities[0]));
+  for (int i = 0; i < 3; ++i) {
+    index.insert(occa::ptrRange(rangeStart(i), 1000),
+                 rangeMemory(i));
+  }
+  ASSERT_EQ(index.retiredSize(),
+            (size_t) 2);
+
+  // Once the first reader leaves, its snapshots get freed even
+  //   though newer readers are in flight
+  slots[1] = &(index.startReading(parities[1]));
+  index.stopReading(*(slots[0]), parities[0]);
+  index.insert(occa::ptrRange(rangeStart(3), 1000),
+               rangeMemory(3));
+  ASSERT_EQ(index.retiredSize(),
+            (size_t) 2);
+
+  index.stopReading(*(slots[1]), parities[1]);
+  index.erase(rangeStart(3));
+  ASSERT_EQ(index.retiredSize(),
+            (size_t) 0);
+  ASSERT_EQ(index.find(rangeStart(1)),
+            rangeMemory(1));
+}
+
+void benchmarkUvaIndex() {
+  const int entries = 100000;
+  const int lookups = 1000000;
+  const int threads = 4;
+
+  occa::uvaIndex index;
+  occa::ptrRangeMap rangeMap;
+
+  double start = occa::sys::currentTime();
+  for (int i = 0; i < entries; ++i) {
+    index.insert(occa::ptrRange(rangeStart(i), 1000),
+                 rangeMemory(i));
+  }
+  const double insertTime = occa::sys::currentTime() - start;
+
+  for (int i = 0; i < entries; ++i) {
+    rangeMap[occa::ptrRange(rangeStart(i), 1000)] = rangeMemory(i);
+  }
+
+  // Single-threaded lookups against the previous std::map index
+  int misses = 0;
+  start = occa::sys::currentTime();
+  for (int i = 0; i < lookups; ++i) {
+    const int r = (int) ((i * 2654435761U) % entries);
+    occa::ptrRangeMap::iterator it = rangeMap.find(rangeStart(r) + 100);
+    misses += ((it == rangeMap.end()) || (it->second != rangeMemory(r)));
+  }
+  const double mapTime = occa::sys::currentTime() - start;
+  ASSERT_EQ(misses, 0);
+
+  uvaReader_t reader;
+  reader.index   = &index;
+  reader.entries = entries;
+  reader.lookups = lookups;
+  start = occa::sys::currentTime();
+  readUvaIndex(&reader);
+  const double indexTime = occa::sys::currentTime() - start;
+  ASSERT_EQ(reader.misses, 0);
+
+  // Concurrent readers while a writer keeps updating other ranges
+  uvaReader_t readers[threads];
+  pthread_t tids[threads];
+  start = occa::sys::currentTime();
+  for (int t = 0; t < threads; ++t) {
+    readers[t] = reader;
+    pthread_create(&tids[t], NULL, readUvaIndex, &readers[t]);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    index.insert(occa::ptrRange(rangeStart(entries + i), 1000),
+                 rangeMemory(entries + i));
+    index.erase(rangeStart(entries + i));
+  }
+  for (int t = 0; t < threads; ++t) {
+    pthread_join(tids[t], NULL);
+    ASSERT_EQ(readers[t].misses, 0);
+  }
+  const double threadedTime = occa::sys::currentTime() - start;
+
+  std::cout << "UVA index with " << entries << " ranges:\n"
+            << "  insert          : " << (1e9 * insertTime / entries) << " ns/op\n"
+            << "  std::map lookup : " << (1e9 * mapTime / lookups) << " ns/op\n"
+            << "  uvaIndex lookup : " << (1e9 * indexTime / lookups) << " ns/op\n"
+            << "  " << threads << " threads lookup: "
+            << (1e9 * threadedTime / (threads * lookups)) << " ns/op\n";
+}